@@ -0,0 +1,172 @@
+#include "TempDirectoryTest.hpp"
+#include <Utils/Filesystem/AsyncFileWriter.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace dotnamecpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+
+  // Records text writes and can hold the worker inside the first one
+  class RecordingWriter final : public IFileWriter {
+  public:
+    struct Call {
+      fs::path path;
+      std::string content;
+      bool append;
+    };
+
+    Result<void, FileError> write(const fs::path &filePath, const std::string &content,
+                                  bool append) const override {
+      std::unique_lock<std::mutex> lock(mutex_);
+      calls_.push_back({filePath, content, append});
+      entered_.notify_all();
+      released_.wait(lock, [this] { return !held_; });
+      return {};
+    }
+
+    Result<void, FileError> writeBytes(const fs::path &, const std::vector<uint8_t> &,
+                                       bool) const override {
+      return {};
+    }
+    Result<void, FileError> writeBytes(const fs::path &, std::span<const uint8_t>,
+                                       const WriteOptions &) const override {
+      return {};
+    }
+    Result<void, FileError> writeLines(const fs::path &, const std::vector<std::string> &,
+                                       bool) const override {
+      return {};
+    }
+    Result<void, FileError> writeLines(const fs::path &, std::span<const std::string_view>,
+                                       bool) const override {
+      return {};
+    }
+    Result<void, FileError> touch(const fs::path &) const override { return {}; }
+    Result<CopyStats, FileError> copyFile(const fs::path &, const fs::path &,
+                                          const CopyOptions &) const override {
+      return CopyStats{};
+    }
+    Result<std::unique_ptr<IFileAppender>, FileError>
+        openAppender(const fs::path &filePath, const AppenderOptions &) const override {
+      return FileError{.code = FileErrorCode::Unknown, .message = "unused", .path = filePath};
+    }
+    Result<MappedOutput, FileError> openMapped(const fs::path &filePath,
+                                               std::size_t) const override {
+      return FileError{.code = FileErrorCode::Unknown, .message = "unused", .path = filePath};
+    }
+
+    void hold() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      held_ = true;
+    }
+
+    void waitUntilEntered() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      entered_.wait(lock, [this] { return !calls_.empty(); });
+    }
+
+    void release() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = false;
+      }
+      released_.notify_all();
+    }
+
+    std::vector<Call> calls() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return calls_;
+    }
+
+  private:
+    mutable std::mutex mutex_;
+    mutable std::condition_variable entered_;
+    mutable std::condition_variable released_;
+    mutable std::vector<Call> calls_;
+    bool held_ = false;
+  };
+
+} // namespace
+
+class AsyncFileWriterTest : public TempDirectoryTest {};
+
+TEST_F(AsyncFileWriterTest, AppliesWritesInOrder) {
+  AsyncFileWriter writer(std::make_shared<FileWriter>());
+  const auto log = testDir_ / "log.txt";
+  const auto data = testDir_ / "data.bin";
+
+  ASSERT_TRUE(writer.write(log, "first\n"));
+  ASSERT_TRUE(writer.writeLines(log, std::vector<std::string>{"second", "third"}, true));
+  ASSERT_TRUE(writer.writeBytes(data, std::vector<uint8_t>{1, 2, 3}));
+  ASSERT_TRUE(writer.write(log, "fourth\n", true));
+  writer.drain();
+
+  EXPECT_EQ(writer.queuedBytes(), 0U);
+  EXPECT_EQ(contentOf(log), "first\nsecond\nthird\nfourth\n");
+  EXPECT_EQ(contentOf(data), std::string("\x01\x02\x03"));
+
+  // touch() waits for the queue, so it sees the written file
+  ASSERT_TRUE(writer.write(testDir_ / "touched.txt", "content"));
+  ASSERT_TRUE(writer.touch(testDir_ / "touched.txt"));
+  EXPECT_EQ(contentOf(testDir_ / "touched.txt"), "content");
+}
+
+TEST_F(AsyncFileWriterTest, CoalescesWritesQueuedWhileBusy) {
+  auto recorder = std::make_shared<RecordingWriter>();
+  AsyncFileWriter writer(recorder);
+
+  recorder->hold();
+  ASSERT_TRUE(writer.write("blocker", "x"));
+  recorder->waitUntilEntered();
+
+  auto first = writer.writeAsync("a", "1", true);
+  auto second = writer.writeAsync("a", "2", true);
+  ASSERT_TRUE(writer.write("b", "3"));
+  ASSERT_TRUE(writer.write("b", "4"));
+  ASSERT_TRUE(writer.write("b", "5", true));
+  ASSERT_TRUE(writer.write("a", "6", true));
+  recorder->release();
+  writer.drain();
+
+  EXPECT_TRUE(first.get());
+  EXPECT_TRUE(second.get());
+  const auto calls = recorder->calls();
+  ASSERT_EQ(calls.size(), 4U);
+  EXPECT_EQ(calls[1].path, "a");
+  EXPECT_EQ(calls[1].content, "12");
+  EXPECT_TRUE(calls[1].append);
+  EXPECT_EQ(calls[2].path, "b");
+  EXPECT_EQ(calls[2].content, "45"); // "3" was truncated away by "4"
+  EXPECT_FALSE(calls[2].append);
+  EXPECT_EQ(calls[3].content, "6");
+}
+
+TEST_F(AsyncFileWriterTest, ReportsErrorsThroughFuturesAndCallback) {
+  std::atomic<int> failures{0};
+  AsyncFileWriter writer(std::make_shared<FileWriter>(),
+                         {.onError = [&failures](const FileError &) { ++failures; }});
+
+  // A directory cannot be written as a file
+  auto failed = writer.writeAsync(testDir_, "content");
+  auto succeeded = writer.writeBytesAsync(testDir_ / "ok.bin", {7});
+  ASSERT_TRUE(writer.write(testDir_, "content"));
+
+  const auto result = failed.get();
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::IsDirectory);
+  EXPECT_TRUE(succeeded.get());
+  writer.drain();
+  EXPECT_EQ(failures.load(), 2);
+
+  auto empty = writer.write("", "content");
+  ASSERT_FALSE(empty.hasValue());
+  EXPECT_EQ(empty.error().code, FileErrorCode::InvalidPath);
+}
@@ -0,0 +1,130 @@
+#include "../../src/Utils/Logger/BasicLogger.hpp"
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+using namespace dotnamecpp::logging;
+namespace fs = std::filesystem;
+
+/**
+ * @brief Sink recording every record it receives
+ *
+ */
+struct RecordingSink {
+  static constexpr bool kEnabled = true;
+
+  struct Record {
+    Level level;
+    std::string message;
+    std::string caller;
+  };
+
+  void write(Level level, std::string_view message, std::string_view caller) {
+    records.push_back({level, std::string(message), std::string(caller)});
+  }
+  void setAppPrefix(std::string_view newPrefix) { prefix = newPrefix; }
+  [[nodiscard]]
+  std::string getAppPrefix() const {
+    return prefix;
+  }
+
+  std::vector<Record> records;
+  std::string prefix;
+};
+
+TEST(BasicLoggerTest, StaticLevelFiltersAtCompileTime) {
+  BasicLogger<RecordingSink, StaticLevel<Level::LOG_WARNING>> logger;
+
+  static_assert(!StaticLevel<Level::LOG_WARNING>::enabled(Level::LOG_INFO));
+  static_assert(StaticLevel<Level::LOG_WARNING>::enabled(Level::LOG_ERROR));
+
+  logger.debug("dropped");
+  logger.info("dropped");
+  logger.warning("kept", "caller");
+  logger.errorFmt("value {}", 42);
+  logger.log(Level::LOG_INFO, "dropped");
+
+  const auto &records = logger.sink().records;
+  ASSERT_EQ(records.size(), 2U);
+  EXPECT_EQ(records[0].level, Level::LOG_WARNING);
+  EXPECT_EQ(records[0].message, "kept");
+  EXPECT_EQ(records[0].caller, "caller");
+  EXPECT_EQ(records[1].message, "value 42");
+}
+
+TEST(BasicLoggerTest, DynamicLevelCanBeChanged) {
+  BasicLogger<RecordingSink, DynamicLevel> logger;
+  logger.setLevel(Level::LOG_ERROR);
+  logger.info("dropped");
+  logger.critical("kept");
+
+  logger.setLevel(Level::LOG_DEBUG);
+  EXPECT_EQ(logger.getLevel(), Level::LOG_DEBUG);
+  logger.debugFmt("{}-{}", "a", 1);
+
+  const auto &records = logger.sink().records;
+  ASSERT_EQ(records.size(), 2U);
+  EXPECT_EQ(records[0].level, Level::LOG_CRITICAL);
+  EXPECT_EQ(records[1].message, "a-1");
+}
+
+TEST(BasicLoggerTest, NullLoggerIsDisabled) {
+  NullBasicLogger logger;
+  static_assert(std::is_empty_v<NullSink>);
+  EXPECT_FALSE(logger.isEnabled(Level::LOG_CRITICAL));
+  logger.critical("nothing happens");
+  logger.criticalFmt("nothing {}", "happens");
+}
+
+TEST(BasicLoggerTest, AdapterForwardsToPolicyLogger) {
+  auto adapter = makeLoggerAdapter<BasicLogger<RecordingSink>>();
+  std::shared_ptr<ILogger> logger = adapter;
+
+  logger->setAppPrefix("App");
+  logger->setLevel(Level::LOG_INFO);
+  logger->debug("dropped");
+  logger->info("hello", "main");
+  logger->warningFmt("count={}", 3);
+  logger->stream(Level::LOG_ERROR) << "streamed " << 7;
+  EXPECT_FALSE(logger->enableFileLogging("unused.log"));
+
+  const auto &sink = adapter->logger().sink();
+  EXPECT_EQ(logger->getAppPrefix(), "App");
+  ASSERT_EQ(sink.records.size(), 3U);
+  EXPECT_EQ(sink.records[0].message, "hello");
+  EXPECT_EQ(sink.records[0].caller, "main");
+  EXPECT_EQ(sink.records[1].message, "count=3");
+  EXPECT_EQ(sink.records[2].level, Level::LOG_ERROR);
+  EXPECT_EQ(sink.records[2].message, "streamed 7");
+}
+
+TEST(BasicLoggerTest, FileSinkThroughAdapter) {
+  const fs::path logPath = fs::temp_directory_path() / "basic_logger_test.log";
+  fs::remove(logPath);
+
+  {
+    auto logger = makeLoggerAdapter<FileBasicLogger>();
+    logger->setAppPrefix("Basic");
+    ASSERT_TRUE(logger->enableFileLogging(logPath.string()));
+    logger->info("written to file", "caller");
+    logger->debug("filtered");
+    logger->disableFileLogging();
+    logger->error("after close");
+  }
+
+  std::ifstream file(logPath);
+  std::stringstream content;
+  content << file.rdbuf();
+  const std::string text = content.str();
+  EXPECT_NE(text.find("[Basic]"), std::string::npos);
+  EXPECT_NE(text.find("[INF][caller] written to file"), std::string::npos);
+  EXPECT_EQ(text.find("filtered"), std::string::npos);
+  EXPECT_EQ(text.find("after close"), std::string::npos);
+
+  fs::remove(logPath);
+}
@@ -0,0 +1,136 @@
+#include <Utils/Filesystem/CachingFileReader.hpp>
+#include <Utils/Filesystem/FileReader.hpp>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+
+using namespace dotnamecpp::utils;
+namespace fs = std::filesystem;
+
+class CachingFileReaderTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "CachingFileReaderTest";
+    fs::create_directories(testDir_);
+    file_ = testDir_ / "cached.txt";
+    std::ofstream(file_) << "first version";
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  static std::shared_ptr<CachingFileReader> makeReader(FileCacheConfig config = {}) {
+    return std::make_shared<CachingFileReader>(std::make_shared<FileReader>(), config);
+  }
+
+  fs::path testDir_;
+  fs::path file_;
+};
+
+TEST_F(CachingFileReaderTest, SecondReadIsServedFromCache) {
+  auto reader = makeReader();
+
+  ASSERT_TRUE(reader->read(file_).hasValue());
+  auto bytes = reader->readBytes(file_);
+  ASSERT_TRUE(bytes.hasValue());
+  EXPECT_EQ(std::string(bytes.value().begin(), bytes.value().end()), "first version");
+
+  const auto stats = reader->stats();
+  EXPECT_EQ(stats.misses, 1U);
+  EXPECT_EQ(stats.hits, 1U);
+  EXPECT_EQ(stats.entries, 1U);
+  EXPECT_EQ(stats.bytes, std::string("first version").size());
+}
+
+TEST_F(CachingFileReaderTest, ModifiedFileIsReloaded) {
+  auto reader = makeReader();
+  ASSERT_EQ(reader->read(file_).value(), "first version");
+
+  // Same size, only the modification time changes
+  std::ofstream(file_) << "other version";
+  fs::last_write_time(file_, fs::last_write_time(file_) + std::chrono::seconds(5));
+  EXPECT_EQ(reader->read(file_).value(), "other version");
+
+  std::ofstream(file_) << "third, longer version";
+  EXPECT_EQ(reader->read(file_).value(), "third, longer version");
+
+  const auto stats = reader->stats();
+  EXPECT_EQ(stats.hits, 0U);
+  EXPECT_EQ(stats.invalidations, 2U);
+  EXPECT_EQ(stats.entries, 1U);
+}
+
+TEST_F(CachingFileReaderTest, EvictsLeastRecentlyUsedWithinBudget) {
+  auto reader = makeReader({.maxBytes = 100, .shardCount = 1, .maxEntrySize = 40});
+  const std::string content(40, 'x');
+  for (const char *name : {"a.txt", "b.txt", "c.txt"}) {
+    std::ofstream(testDir_ / name) << content;
+  }
+
+  ASSERT_TRUE(reader->read(testDir_ / "a.txt").hasValue());
+  ASSERT_TRUE(reader->read(testDir_ / "b.txt").hasValue());
+  ASSERT_TRUE(reader->read(testDir_ / "a.txt").hasValue()); // b becomes least recent
+  ASSERT_TRUE(reader->read(testDir_ / "c.txt").hasValue());
+
+  auto stats = reader->stats();
+  EXPECT_EQ(stats.evictions, 1U);
+  EXPECT_EQ(stats.entries, 2U);
+  EXPECT_LE(stats.bytes, 100U);
+
+  ASSERT_TRUE(reader->read(testDir_ / "a.txt").hasValue());
+  EXPECT_EQ(reader->stats().hits, stats.hits + 1);
+}
+
+TEST_F(CachingFileReaderTest, LargeFilesBypassCache) {
+  auto reader = makeReader({.maxBytes = 1024, .shardCount = 1, .maxEntrySize = 8});
+
+  ASSERT_EQ(reader->read(file_).value(), "first version");
+  ASSERT_EQ(reader->read(file_).value(), "first version");
+
+  const auto stats = reader->stats();
+  EXPECT_EQ(stats.misses, 2U);
+  EXPECT_EQ(stats.entries, 0U);
+}
+
+TEST_F(CachingFileReaderTest, InvalidateAndErrorsPassThrough) {
+  auto reader = makeReader();
+  ASSERT_TRUE(reader->read(file_).hasValue());
+  reader->invalidate(testDir_ / "." / "cached.txt"); // Same key after normalization
+  EXPECT_EQ(reader->stats().entries, 0U);
+
+  auto missing = reader->read(testDir_ / "missing.txt");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+
+  auto directory = reader->read(testDir_);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(CachingFileReaderTest, WatcherInvalidatesWatchedEntries) {
+  auto watcher = std::make_shared<FileWatcher>();
+  auto reader = std::make_shared<CachingFileReader>(std::make_shared<FileReader>(),
+                                                    FileCacheConfig{}, watcher);
+
+  ASSERT_EQ(reader->read(file_).value(), "first version");
+  EXPECT_TRUE(watcher->isWatching(file_));
+  ASSERT_EQ(reader->read(file_).value(), "first version");
+  EXPECT_EQ(reader->stats().hits, 1U);
+
+  std::ofstream(file_) << "second version, reported by the watcher";
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+  while (reader->stats().entries != 0 && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  }
+  EXPECT_EQ(reader->read(file_).value(), "second version, reported by the watcher");
+
+  // Entries release their watches when the cache goes away
+  reader.reset();
+  EXPECT_EQ(watcher->watchedCount(), 0U);
+}
@@ -0,0 +1,76 @@
+#include <Utils/Filesystem/Checksum.hpp>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <span>
+#include <string>
+#include <string_view>
+
+using namespace dotnamecpp::utils;
+
+namespace {
+  std::span<const std::byte> bytesOf(std::string_view text) {
+    return std::as_bytes(std::span<const char>(text.data(), text.size()));
+  }
+} // namespace
+
+TEST(ChecksumTest, Crc32cMatchesReferenceValues) {
+  EXPECT_EQ(Checksum::crc32c(bytesOf("")), 0x00000000U);
+  EXPECT_EQ(Checksum::crc32c(bytesOf("123456789")), 0xE3069283U);
+  // 32 bytes of zeros, from RFC 3720 (iSCSI)
+  EXPECT_EQ(Checksum::crc32c(bytesOf(std::string(32, '\0'))), 0x8A9136AAU);
+
+  // Continuing from a previous result equals hashing the concatenation
+  EXPECT_EQ(Checksum::crc32c(bytesOf("56789"), Checksum::crc32c(bytesOf("1234"))), 0xE3069283U);
+}
+
+TEST(ChecksumTest, Crc32cTableFallbackMatchesReferenceValues) {
+  EXPECT_EQ(Checksum::crc32cTable(bytesOf("")), 0x00000000U);
+  EXPECT_EQ(Checksum::crc32cTable(bytesOf("123456789")), 0xE3069283U);
+  EXPECT_EQ(Checksum::crc32cTable(bytesOf(std::string(32, '\0'))), 0x8A9136AAU);
+  EXPECT_EQ(Checksum::crc32cTable(bytesOf("56789"), Checksum::crc32cTable(bytesOf("1234"))),
+            0xE3069283U);
+}
+
+TEST(ChecksumTest, Crc32cAgreesWithTableFallback) {
+  std::string data;
+  for (int i = 0; i < 4096; ++i) {
+    data += static_cast<char>((i * 131) ^ (i >> 3));
+  }
+  // Every length and start offset around the 8-byte word boundaries
+  for (std::size_t offset = 0; offset < 16; ++offset) {
+    for (std::size_t length = 0; length < 80; ++length) {
+      const auto piece = bytesOf(std::string_view(data).substr(offset, length));
+      EXPECT_EQ(Checksum::crc32c(piece), Checksum::crc32cTable(piece))
+          << "offset " << offset << ", length " << length;
+    }
+  }
+  EXPECT_EQ(Checksum::crc32c(bytesOf(data)), Checksum::crc32cTable(bytesOf(data)));
+}
+
+TEST(ChecksumTest, XxHash64MatchesReferenceValues) {
+  EXPECT_EQ(Checksum::xxHash64(bytesOf("")), 0xEF46DB3751D8E999ULL);
+  EXPECT_EQ(Checksum::xxHash64(bytesOf("abc")), 0x44BC2CF5AD770999ULL);
+  EXPECT_EQ(Checksum::xxHash64(bytesOf("Nobody inspects the spammish repetition")),
+            0xFBCEA83C8A378BF1ULL);
+}
+
+TEST(ChecksumTest, IncrementalDigestEqualsOneShot) {
+  std::string data;
+  for (int i = 0; i < 1000; ++i) {
+    data += static_cast<char>(i * 7);
+  }
+
+  for (const auto algorithm : {ChecksumAlgorithm::Crc32c, ChecksumAlgorithm::XxHash64}) {
+    const std::uint64_t expected =
+        algorithm == ChecksumAlgorithm::Crc32c ? Checksum::crc32c(bytesOf(data))
+                                               : Checksum::xxHash64(bytesOf(data));
+    // Piece sizes around the 8-byte word and the 32-byte XXH64 stripe
+    for (const std::size_t piece : {1U, 3U, 8U, 31U, 32U, 33U, 100U, 1000U}) {
+      Checksum checksum(algorithm);
+      for (std::size_t offset = 0; offset < data.size(); offset += piece) {
+        checksum.update(std::string_view(data).substr(offset, piece));
+      }
+      EXPECT_EQ(checksum.digest(), expected) << "piece size " << piece;
+    }
+  }
+}
@@ -1,5 +1,6 @@
 #include "../../src/Utils/Logger/ConsoleLogger.hpp"
 #include <chrono>
+#include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
 #include <memory>
@@ -193,6 +194,47 @@ TEST_F(ConsoleLoggerTest, ColorMethods) {
   EXPECT_NO_THROW(ConsoleLogger::resetConsoleColor());
 }
 
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+TEST_F(ConsoleLoggerTest, ColoredRecordWrittenInOnePiece) {
+  std::cout.flush();
+  logger->setAppPrefix("App");
+  logger->setColorEnabled(true);
+  testing::internal::CaptureStdout();
+  logger->warning("colored", "caller");
+  const std::string output = testing::internal::GetCapturedStdout();
+
+  EXPECT_EQ(output.rfind("\033[33m[App][", 0), 0U);
+  EXPECT_NE(output.find("[WRN][caller] colored\n\033[0m"), std::string::npos);
+
+  logger->setColorEnabled(false);
+  testing::internal::CaptureStdout();
+  logger->info("plain");
+  const std::string plain = testing::internal::GetCapturedStdout();
+  EXPECT_EQ(plain.find('\033'), std::string::npos);
+  EXPECT_NE(plain.find("[INF] plain\n"), std::string::npos);
+}
+
+TEST_F(ConsoleLoggerTest, RecordsStayOrderedWithBufferedStdout) {
+  logger->setColorEnabled(false);
+  testing::internal::CaptureStdout();
+  // fd 1 is a file now, so stdio holds these in its buffer
+  std::printf("printf first\n");
+  std::cout << "cout second\n";
+  logger->info("record third");
+  std::printf("printf fourth\n");
+  const std::string output = testing::internal::GetCapturedStdout();
+
+  const auto first = output.find("printf first");
+  const auto second = output.find("cout second");
+  const auto third = output.find("record third");
+  const auto fourth = output.find("printf fourth");
+  ASSERT_NE(fourth, std::string::npos);
+  EXPECT_LT(first, second);
+  EXPECT_LT(second, third);
+  EXPECT_LT(third, fourth);
+}
+#endif
+
 TEST_F(ConsoleLoggerTest, PolymorphicUsage) {
   // Test using logger through ILogger interface
   std::shared_ptr<ILogger> interfaceLogger = std::make_shared<ConsoleLogger>();
@@ -263,3 +305,148 @@ TEST_F(ConsoleLoggerTest, LongMessages) {
   EXPECT_NO_THROW(logger->infoStream() << longMessage);
   EXPECT_NO_THROW(logger->infoFmt("Long: {}", longMessage));
 }
+
+#ifndef _WIN32
+TEST_F(ConsoleLoggerTest, MappedFileLogging) {
+  const auto dir = std::filesystem::temp_directory_path() / "ConsoleLoggerMappedTest";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+
+  ASSERT_TRUE(logger->enableMappedFileLogging((dir / "audit.log").string()));
+  logger->info("Audit record 1", "MappedFileLogging");
+  logger->warning("Audit record 2", "MappedFileLogging");
+  logger->error("Audit record 3", "MappedFileLogging");
+  logger->disableFileLogging();
+
+  // Segment is truncated to the written bytes once the logger lets go of it
+  std::ifstream file(dir / "audit.000000.log");
+  ASSERT_TRUE(file.is_open());
+  std::string line;
+  int lineCount = 0;
+  while (std::getline(file, line)) {
+    EXPECT_NE(line.find("Audit record " + std::to_string(++lineCount)), std::string::npos);
+  }
+  EXPECT_EQ(lineCount, 3);
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST_F(ConsoleLoggerTest, MappedLogFileConcurrentAppendsAcrossSegments) {
+  const auto dir = std::filesystem::temp_directory_path() / "MappedLogFileTest";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+
+  const int numThreads = 4;
+  const int recordsPerThread = 2000;
+  {
+    MappedLogFile mapped;
+    // Small segments and a fast timer force plenty of rollovers while writers are active
+    ASSERT_TRUE(mapped.open(dir / "audit.log", 4096, std::chrono::milliseconds(1)));
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads);
+    for (int t = 0; t < numThreads; ++t) {
+      threads.emplace_back([&mapped, t] {
+        for (int i = 0; i < recordsPerThread; ++i) {
+          mapped.append(fmt::format("thread {} record {:05}\n", t, i));
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    mapped.close();
+  }
+
+  int segments = 0;
+  int records = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+    ++segments;
+    std::ifstream file(entry.path());
+    std::string line;
+    while (std::getline(file, line)) {
+      EXPECT_EQ(line.rfind("thread ", 0), 0U) << line;
+      ++records;
+    }
+  }
+  EXPECT_GT(segments, 1);
+  EXPECT_EQ(records, numThreads * recordsPerThread);
+
+  std::filesystem::remove_all(dir);
+}
+
+TEST_F(ConsoleLoggerTest, MappedLogFileFreesRotatedSegments) {
+  const auto dir = std::filesystem::temp_directory_path() / "MappedLogFileRotationTest";
+  std::filesystem::remove_all(dir);
+  std::filesystem::create_directories(dir);
+
+  const std::string record(1000, 'x');
+  {
+    // Without a timer, rollovers finalize and free the previous segments themselves
+    MappedLogFile mapped;
+    ASSERT_TRUE(mapped.open(dir / "inline.log", 4096, std::chrono::milliseconds(0)));
+    for (int i = 0; i < 2000; ++i) {
+      ASSERT_TRUE(mapped.append(record));
+    }
+    EXPECT_EQ(mapped.liveSegmentCount(), 1U);
+  }
+  {
+    MappedLogFile mapped;
+    ASSERT_TRUE(mapped.open(dir / "timer.log", 4096, std::chrono::milliseconds(1)));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&mapped, &record] {
+        for (int i = 0; i < 1000; ++i) {
+          mapped.append(record);
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    // The sync thread catches up with roughly a thousand rollovers within a few ticks
+    for (int tick = 0; tick < 500 && mapped.liveSegmentCount() > 1; ++tick) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    }
+    EXPECT_EQ(mapped.liveSegmentCount(), 1U);
+  }
+
+  std::uintmax_t bytes = 0;
+  for (const auto &entry : std::filesystem::directory_iterator(dir)) {
+    bytes += entry.file_size();
+  }
+  EXPECT_EQ(bytes, record.size() * 6000);
+
+  std::filesystem::remove_all(dir);
+}
+#endif
+
+TEST_F(ConsoleLoggerTest, LocationLogging) {
+  EXPECT_NO_THROW(logger->debugWithLocation("Debug with location"));
+  EXPECT_NO_THROW(logger->infoWithLocation("Info with location"));
+  EXPECT_NO_THROW(logger->warningWithLocation("Warning with location"));
+  EXPECT_NO_THROW(logger->errorWithLocation("Error with location"));
+  EXPECT_NO_THROW(logger->criticalWithLocation("Critical with location"));
+}
+
+TEST_F(ConsoleLoggerTest, CallSitesAreInternedOnce) {
+  auto intern = [](const std::source_location &location = std::source_location::current()) {
+    return CallSiteRegistry::intern(location);
+  };
+
+  CallSiteId first = 0;
+  for (int i = 0; i < 3; ++i) {
+    const CallSiteId id = intern(); // same call site on every iteration
+    if (i == 0) {
+      first = id;
+    }
+    EXPECT_EQ(id, first);
+  }
+  const CallSiteId other = intern();
+  EXPECT_NE(other, first);
+
+  const CallSite site = CallSiteRegistry::get(first);
+  EXPECT_EQ(site.fileName, "ConsoleLoggerTest.cpp");
+  EXPECT_EQ(CallSiteRegistry::format(other),
+            "ConsoleLoggerTest.cpp:" + std::to_string(CallSiteRegistry::get(other).line));
+}
@@ -0,0 +1,93 @@
+#include "TempDirectoryTest.hpp"
+#include <Utils/Filesystem/DirectoryManager.hpp>
+#include <Utils/Filesystem/FileCopy.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace dotnamecpp::utils;
+namespace fs = std::filesystem;
+
+class FileCopyTest : public TempDirectoryTest {
+protected:
+  static void createFile(const fs::path &path, const std::string &content) {
+    fs::create_directories(path.parent_path());
+    std::ofstream(path, std::ios::binary) << content;
+  }
+};
+
+TEST_F(FileCopyTest, CopiesContentAndPermissions) {
+  std::string content;
+  for (int i = 0; i < 3 * 1024 * 1024; ++i) {
+    content += static_cast<char>((i * 31) ^ (i >> 9));
+  }
+  const auto source = testDir_ / "source.bin";
+  createFile(source, content);
+  fs::permissions(source, fs::perms::owner_read | fs::perms::owner_write | fs::perms::group_read);
+
+  FileWriter writer;
+  const auto destination = testDir_ / "nested" / "copy.bin";
+  auto stats = writer.copyFile(source, destination);
+  ASSERT_TRUE(stats) << stats.error().message;
+  EXPECT_EQ(stats.value().bytes, content.size());
+  EXPECT_EQ(contentOf(destination), content);
+  EXPECT_EQ(fs::status(destination).permissions(), fs::status(source).permissions());
+
+  auto empty = copyFile(testDir_ / "empty", testDir_ / "empty.copy");
+  EXPECT_FALSE(empty.hasValue());
+  createFile(testDir_ / "empty", "");
+  empty = copyFile(testDir_ / "empty", testDir_ / "empty.copy");
+  ASSERT_TRUE(empty);
+  EXPECT_EQ(empty.value().bytes, 0U);
+}
+
+TEST_F(FileCopyTest, HonoursOverwriteAndRejectsSameFile) {
+  const auto source = testDir_ / "source.txt";
+  const auto destination = testDir_ / "destination.txt";
+  createFile(source, "new content");
+  createFile(destination, "old content that is longer");
+
+  auto refused = copyFile(source, destination);
+  ASSERT_FALSE(refused.hasValue());
+  EXPECT_EQ(refused.error().code, FileErrorCode::AlreadyExists);
+  EXPECT_EQ(contentOf(destination), "old content that is longer");
+
+  ASSERT_TRUE(copyFile(source, destination, {.overwrite = true}));
+  EXPECT_EQ(contentOf(destination), "new content");
+
+  auto same = copyFile(source, testDir_ / "." / "source.txt", {.overwrite = true});
+  ASSERT_FALSE(same.hasValue());
+  EXPECT_EQ(contentOf(source), "new content");
+
+  auto directory = copyFile(testDir_, testDir_ / "other");
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileCopyTest, CopiesDirectoryTrees) {
+  const auto source = testDir_ / "tree";
+  createFile(source / "a.txt", "a");
+  createFile(source / "sub" / "b.txt", "b");
+  createFile(source / "sub" / "deeper" / "c.txt", "c");
+  fs::create_directories(source / "empty");
+  std::error_code ec;
+  fs::create_symlink("a.txt", source / "link", ec);
+
+  DirectoryManager directories;
+  const auto destination = testDir_ / "copy";
+  auto copied = directories.copyDirectory(source, destination);
+  ASSERT_TRUE(copied) << copied.error().message;
+  EXPECT_EQ(copied.value(), 3U);
+  EXPECT_EQ(contentOf(destination / "sub" / "deeper" / "c.txt"), "c");
+  EXPECT_TRUE(fs::is_directory(destination / "empty"));
+  if (!ec) {
+    EXPECT_TRUE(fs::is_symlink(destination / "link"));
+    EXPECT_EQ(fs::read_symlink(destination / "link"), "a.txt");
+  }
+
+  EXPECT_FALSE(directories.copyDirectory(source, destination).hasValue());
+  EXPECT_TRUE(directories.copyDirectory(source, destination, {.overwrite = true}));
+  EXPECT_FALSE(directories.copyDirectory(source, source / "sub" / "inside").hasValue());
+}
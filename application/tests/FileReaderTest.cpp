@@ -1,8 +1,27 @@
 #include <Utils/Filesystem/FileReader.hpp>
+#include <Utils/Filesystem/IoThreadPool.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 
 using namespace dotnamecpp::utils;
 namespace fs = std::filesystem;
@@ -167,6 +186,33 @@ TEST_F(FileReaderTest, ReadFailsForEmptyPath) {
   EXPECT_EQ(result.error().code, dotnamecpp::utils::FileErrorCode::InvalidPath);
 }
 
+#ifndef _WIN32
+TEST_F(FileReaderTest, ReadFailsWithAccessDeniedForUnreadableFile) {
+  if (::geteuid() == 0) {
+    GTEST_SKIP() << "root bypasses file permissions";
+  }
+  fs::permissions(simpleFile_, fs::perms::none);
+
+  FileReader reader;
+  auto text = reader.read(simpleFile_);
+  auto bytes = reader.readBytes(simpleFile_);
+  fs::permissions(simpleFile_, fs::perms::owner_read | fs::perms::owner_write);
+
+  ASSERT_FALSE(text.hasValue());
+  EXPECT_EQ(text.error().code, dotnamecpp::utils::FileErrorCode::AccessDenied);
+  ASSERT_FALSE(bytes.hasValue());
+  EXPECT_EQ(bytes.error().code, dotnamecpp::utils::FileErrorCode::AccessDenied);
+}
+#endif
+
+TEST_F(FileReaderTest, ReadFailsWithNotFoundBelowRegularFile) {
+  FileReader reader;
+  auto result = reader.read(simpleFile_ / "child.txt");
+
+  EXPECT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
+}
+
 // ============================================================================
 // readBytes() tests
 // ============================================================================
@@ -205,6 +251,134 @@ TEST_F(FileReaderTest, ReadBytesFailsForNonexistentFile) {
   EXPECT_EQ(result.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
 }
 
+// ============================================================================
+// readInto() / readPooled() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadIntoSpanReportsBytesRead) {
+  FileReader reader;
+  std::array<std::byte, 64> buffer{};
+  auto result = reader.readInto(simpleFile_, std::span<std::byte>(buffer));
+
+  ASSERT_TRUE(result.hasValue());
+  ASSERT_EQ(result.value(), 13U);
+  EXPECT_EQ(std::string_view(reinterpret_cast<const char *>(buffer.data()), result.value()),
+            "Hello, World!");
+
+  std::array<std::byte, 13> exact{};
+  auto exactResult = reader.readInto(simpleFile_, std::span<std::byte>(exact));
+  ASSERT_TRUE(exactResult.hasValue());
+  EXPECT_EQ(exactResult.value(), 13U);
+}
+
+TEST_F(FileReaderTest, ReadIntoSpanFailsWhenFileDoesNotFit) {
+  FileReader reader;
+  std::array<std::byte, 4> buffer{};
+  auto result = reader.readInto(simpleFile_, std::span<std::byte>(buffer));
+
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, dotnamecpp::utils::FileErrorCode::ReadError);
+}
+
+TEST_F(FileReaderTest, ReadIntoPmrStringUsesItsResource) {
+  std::array<std::byte, 4096> arena{};
+  std::pmr::monotonic_buffer_resource resource(arena.data(), arena.size(),
+                                               std::pmr::null_memory_resource());
+  std::pmr::string buffer(&resource);
+
+  FileReader reader;
+  auto result = reader.readInto(unicodeFile_, buffer);
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(buffer, "Unicode: 你好世界 🌍");
+
+  // Reading a smaller file reuses the capacity
+  auto second = reader.readInto(simpleFile_, buffer);
+  ASSERT_TRUE(second.hasValue());
+  EXPECT_EQ(second.value(), 13U);
+  EXPECT_EQ(buffer, "Hello, World!");
+}
+
+TEST_F(FileReaderTest, ReadPooledReusesBuffers) {
+  FileReader reader;
+  BufferPool pool;
+  const std::byte *firstData = nullptr;
+  {
+    auto result = reader.readPooled(unicodeFile_, pool);
+    ASSERT_TRUE(result.hasValue());
+    firstData = result.value().bytes().data();
+    EXPECT_EQ(result.value().view(), "Unicode: 你好世界 🌍");
+  }
+  EXPECT_EQ(pool.idleCount(), 1U);
+
+  auto result = reader.readPooled(simpleFile_, pool);
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value().view(), "Hello, World!");
+  EXPECT_EQ(result.value().bytes().data(), firstData);
+  EXPECT_EQ(pool.idleCount(), 0U);
+
+  auto empty = reader.readPooled(emptyFile_, pool);
+  ASSERT_TRUE(empty.hasValue());
+  EXPECT_EQ(empty.value().size(), 0U);
+}
+
+// ============================================================================
+// readMapped() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadMappedExposesFileContent) {
+  FileReader reader;
+  auto result = reader.readMapped(binaryFile_);
+
+  ASSERT_TRUE(result.hasValue());
+  const MappedFile mapped = std::move(result).value();
+  ASSERT_EQ(mapped.size(), 5U);
+  EXPECT_EQ(mapped.bytes()[2], std::byte{0x42});
+#ifndef _WIN32
+  EXPECT_TRUE(mapped.isMapped());
+#endif
+
+  auto text = reader.readMapped(simpleFile_);
+  ASSERT_TRUE(text.hasValue());
+  EXPECT_EQ(text.value().view(), "Hello, World!");
+}
+
+TEST_F(FileReaderTest, ReadMappedHandlesEmptyFile) {
+  FileReader reader;
+  auto result = reader.readMapped(emptyFile_);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_TRUE(result.value().empty());
+  EXPECT_TRUE(result.value().view().empty());
+}
+
+TEST_F(FileReaderTest, ReadMappedFailsForMissingFileAndDirectory) {
+  FileReader reader;
+  auto missing = reader.readMapped(testDir_ / "nonexistent.bin");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
+
+  auto directory = reader.readMapped(testDir_);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, dotnamecpp::utils::FileErrorCode::IsDirectory);
+}
+
+#ifndef _WIN32
+TEST_F(FileReaderTest, ReadMappedFallsBackToReadingPipes) {
+  int fds[2];
+  ASSERT_EQ(::pipe(fds), 0);
+  ASSERT_EQ(::write(fds[1], "piped", 5), 5);
+  ::close(fds[1]);
+
+  FileReader reader;
+  auto result = reader.readMapped(fs::path("/proc/self/fd") / std::to_string(fds[0]));
+  ::close(fds[0]);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_FALSE(result.value().isMapped());
+  EXPECT_EQ(result.value().view(), "piped");
+}
+#endif
+
 // ============================================================================
 // readLines() tests
 // ============================================================================
@@ -253,6 +427,413 @@ TEST_F(FileReaderTest, ReadLinesFailsForNonexistentFile) {
   EXPECT_EQ(result.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
 }
 
+// ============================================================================
+// readLineView() / forEachLine() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadLineViewYieldsLinesWithoutTerminators) {
+  const fs::path crlfFile = testDir_ / "crlf.txt";
+  std::ofstream(crlfFile, std::ios::binary) << "first\r\nsecond\n\nlast";
+
+  FileReader reader;
+  auto result = reader.readLineView(crlfFile);
+  ASSERT_TRUE(result.hasValue());
+
+  std::vector<std::string_view> lines(result.value().begin(), result.value().end());
+  std::vector<std::string_view> expected = {"first", "second", "", "last"};
+  EXPECT_EQ(lines, expected);
+}
+
+TEST_F(FileReaderTest, ReadLineViewMatchesReadLines) {
+  FileReader reader;
+  auto view = reader.readLineView(multiLineFile_);
+  auto lines = reader.readLines(multiLineFile_);
+  ASSERT_TRUE(view.hasValue());
+  ASSERT_TRUE(lines.hasValue());
+
+  std::vector<std::string> fromView(view.value().begin(), view.value().end());
+  EXPECT_EQ(fromView, lines.value());
+
+  auto empty = reader.readLineView(emptyFile_);
+  ASSERT_TRUE(empty.hasValue());
+  EXPECT_EQ(empty.value().begin(), empty.value().end());
+}
+
+TEST_F(FileReaderTest, ForEachLineStreamsThroughSmallBuffer) {
+  const fs::path largeFile = testDir_ / "lines.txt";
+  {
+    std::ofstream out(largeFile, std::ios::binary);
+    for (int i = 0; i < 1000; ++i) {
+      out << "line " << i << (i % 2 == 0 ? "\r\n" : "\n");
+    }
+    out << std::string(100, 'x'); // Longer than the buffer and unterminated
+  }
+
+  FileReader reader;
+  std::vector<std::string> lines;
+  auto result = reader.forEachLine(
+      largeFile,
+      [&lines](std::string_view line) {
+        lines.emplace_back(line);
+        return true;
+      },
+      16);
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 1001U);
+  ASSERT_EQ(lines.size(), 1001U);
+  EXPECT_EQ(lines[0], "line 0");
+  EXPECT_EQ(lines[999], "line 999");
+  EXPECT_EQ(lines[1000], std::string(100, 'x'));
+}
+
+TEST_F(FileReaderTest, ForEachLineStopsWhenCallbackReturnsFalse) {
+  FileReader reader;
+  std::vector<std::string> lines;
+  auto result = reader.forEachLine(multiLineFile_, [&lines](std::string_view line) {
+    lines.emplace_back(line);
+    return lines.size() < 2;
+  });
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), 2U);
+  EXPECT_EQ(lines.back(), "Line 2");
+
+  auto missing = reader.forEachLine(testDir_ / "missing.txt",
+                                    [](std::string_view /*line*/) { return true; });
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
+}
+
+// ============================================================================
+// readChunks() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadChunksDeliversWholeFileInOrder) {
+  const fs::path dataFile = testDir_ / "chunks.bin";
+  std::string expected;
+  for (int i = 0; i < 10000; ++i) {
+    expected += static_cast<char>('a' + (i % 26));
+  }
+  std::ofstream(dataFile, std::ios::binary) << expected;
+
+  FileReader reader;
+  for (const bool readAhead : {false, true}) {
+    std::string collected;
+    std::size_t chunks = 0;
+    auto result = reader.readChunks(
+        dataFile,
+        [&](std::span<const std::byte> chunk) {
+          EXPECT_LE(chunk.size(), 1000U);
+          collected.append(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+          ++chunks;
+          return true;
+        },
+        ReadChunkOptions{.chunkSize = 1000, .readAhead = readAhead});
+
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(result.value(), expected.size());
+    EXPECT_EQ(collected, expected);
+    EXPECT_EQ(chunks, 10U);
+  }
+}
+
+TEST_F(FileReaderTest, ReadChunksStopsEarlyAndReportsErrors) {
+  FileReader reader;
+  for (const bool readAhead : {false, true}) {
+    std::size_t chunks = 0;
+    auto result = reader.readChunks(
+        unicodeFile_,
+        [&chunks](std::span<const std::byte> /*chunk*/) { return ++chunks < 2; },
+        ReadChunkOptions{.chunkSize = 4, .readAhead = readAhead});
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(chunks, 2U);
+    EXPECT_EQ(result.value(), 8U);
+  }
+
+  auto empty = reader.readChunks(emptyFile_, [](std::span<const std::byte> /*chunk*/) {
+    ADD_FAILURE() << "no chunk expected for an empty file";
+    return true;
+  });
+  ASSERT_TRUE(empty.hasValue());
+  EXPECT_EQ(empty.value(), 0U);
+
+  auto directory =
+      reader.readChunks(testDir_, [](std::span<const std::byte> /*chunk*/) { return true; });
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, dotnamecpp::utils::FileErrorCode::IsDirectory);
+}
+
+// ============================================================================
+// readParallel() / readRangesParallel() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadParallelMatchesSequentialRead) {
+  const fs::path dataFile = testDir_ / "parallel.bin";
+  {
+    std::ofstream out(dataFile, std::ios::binary);
+    for (int i = 0; i < 300000; ++i) {
+      out.put(static_cast<char>((i * 7) % 251));
+    }
+  }
+
+  FileReader reader;
+  IoThreadPool pool(4);
+  const ParallelReadOptions options{.minRangeSize = 64 * 1024, .pool = &pool};
+  auto parallel = reader.readParallel(dataFile, options);
+  auto sequential = reader.readBytes(dataFile);
+
+  ASSERT_TRUE(parallel.hasValue());
+  ASSERT_TRUE(sequential.hasValue());
+  EXPECT_EQ(parallel.value(), sequential.value());
+
+  auto empty = reader.readParallel(emptyFile_, options);
+  ASSERT_TRUE(empty.hasValue());
+  EXPECT_TRUE(empty.value().empty());
+
+  auto missing = reader.readParallel(testDir_ / "missing.bin", options);
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
+}
+
+TEST_F(FileReaderTest, ReadRangesParallelCoversEveryByteOnce) {
+  const fs::path dataFile = testDir_ / "ranges.bin";
+  constexpr std::size_t kSize = 1000000;
+  {
+    std::ofstream out(dataFile, std::ios::binary);
+    for (std::size_t i = 0; i < kSize; ++i) {
+      out.put(static_cast<char>(i % 256));
+    }
+  }
+
+  FileReader reader;
+  IoThreadPool pool(3);
+  std::vector<std::atomic<int>> seen(kSize);
+  std::atomic<bool> contentMatches{true};
+  auto result = reader.readRangesParallel(
+      dataFile,
+      [&](std::uintmax_t offset, std::span<const std::byte> data) {
+        for (std::size_t i = 0; i < data.size(); ++i) {
+          seen[offset + i].fetch_add(1);
+          if (data[i] != static_cast<std::byte>((offset + i) % 256)) {
+            contentMatches = false;
+          }
+        }
+        return true;
+      },
+      ParallelReadOptions{.minRangeSize = 64 * 1024, .chunkSize = 10000, .pool = &pool});
+
+  ASSERT_TRUE(result.hasValue());
+  EXPECT_EQ(result.value(), kSize);
+  EXPECT_TRUE(contentMatches);
+  EXPECT_TRUE(std::all_of(seen.begin(), seen.end(), [](const auto &count) { return count == 1; }));
+}
+
+TEST_F(FileReaderTest, ReadRangesParallelRethrowsOnceAllRangesFinished) {
+  const fs::path dataFile = testDir_ / "throwing.bin";
+  {
+    std::ofstream out(dataFile, std::ios::binary);
+    out << std::string(1000000, 'x');
+  }
+
+  FileReader reader;
+  IoThreadPool pool(3);
+  std::atomic<int> running{0};
+  std::atomic<int> maxRunning{0};
+  const auto readAndThrow = [&] {
+    return reader.readRangesParallel(
+        dataFile,
+        [&](std::uintmax_t offset, std::span<const std::byte> /*data*/) {
+          running.fetch_add(1);
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          running.fetch_sub(1);
+          if (offset == 0) {
+            throw std::runtime_error("callback failed");
+          }
+          return true;
+        },
+        ParallelReadOptions{.minRangeSize = 64 * 1024, .chunkSize = 10000, .pool = &pool});
+  };
+  EXPECT_THROW((void)readAndThrow(), std::runtime_error);
+  // No range is still using the caller's stack once the exception arrives
+  EXPECT_EQ(running.load(), 0);
+
+  // Called from a worker of the same pool, the ranges run inline instead of deadlocking
+  auto nested = pool.submit([&] {
+    return reader.readParallel(dataFile,
+                               ParallelReadOptions{.minRangeSize = 64 * 1024, .pool = &pool});
+  });
+  ASSERT_EQ(nested.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  auto nestedResult = nested.get();
+  ASSERT_TRUE(nestedResult.hasValue());
+  EXPECT_EQ(nestedResult.value().size(), 1000000U);
+}
+
+#ifdef __linux__
+TEST_F(FileReaderTest, ReadParallelReadsProcfsFiles) {
+  FileReader reader;
+  auto parallel = reader.readParallel("/proc/self/status");
+  ASSERT_TRUE(parallel.hasValue());
+  EXPECT_FALSE(parallel.value().empty());
+
+  std::uintmax_t delivered = 0;
+  auto ranges = reader.readRangesParallel(
+      "/proc/self/status", [&](std::uintmax_t /*offset*/, std::span<const std::byte> data) {
+        delivered += data.size();
+        return true;
+      });
+  ASSERT_TRUE(ranges.hasValue());
+  EXPECT_GT(delivered, 0U);
+}
+#endif
+
+// ============================================================================
+// readAsync() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadAsyncReturnsFuturesInPathOrder) {
+  FileReader reader;
+  IoThreadPool pool(2);
+  const std::vector<fs::path> paths = {simpleFile_, testDir_ / "missing.txt", multiLineFile_};
+  auto results = reader.readAsync(paths, &pool);
+
+  ASSERT_EQ(results.size(), 3U);
+  auto simple = results[0].get();
+  auto missing = results[1].get();
+  auto multiLine = results[2].get();
+  ASSERT_TRUE(simple.hasValue());
+  EXPECT_EQ(simple.value(), "Hello, World!");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
+  ASSERT_TRUE(multiLine.hasValue());
+  EXPECT_EQ(multiLine.value(), "Line 1\nLine 2\nLine 3\n");
+}
+
+TEST_F(FileReaderTest, ReadAsyncInvokesCompletionForEveryPath) {
+  std::vector<fs::path> paths;
+  for (int i = 0; i < 50; ++i) {
+    paths.push_back(testDir_ / ("asset_" + std::to_string(i) + ".txt"));
+    std::ofstream(paths.back()) << "asset " << i;
+  }
+
+  FileReader reader;
+  std::mutex mutex;
+  std::map<std::string, std::string> contents;
+  auto done = reader.readAsync(paths, [&](const fs::path &path,
+                                          Result<std::string, FileError> result) {
+    ASSERT_TRUE(result.hasValue());
+    std::lock_guard<std::mutex> lock(mutex);
+    contents[path.filename().string()] = result.value();
+  });
+  done.get();
+
+  ASSERT_EQ(contents.size(), 50U);
+  EXPECT_EQ(contents["asset_7.txt"], "asset 7");
+
+  auto failing = reader.readAsync({simpleFile_}, [](const fs::path & /*path*/,
+                                                    Result<std::string, FileError> /*result*/) {
+    throw std::runtime_error("completion failed");
+  });
+  EXPECT_THROW(failing.get(), std::runtime_error);
+}
+
+// ============================================================================
+// readWithChecksum() and hashFile() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadWithChecksumHashesInTheSamePass) {
+  const fs::path dataFile = testDir_ / "checked.bin";
+  std::string expected;
+  for (int i = 0; i < 300 * 1024; ++i) {
+    expected += static_cast<char>(i % 251);
+  }
+  std::ofstream(dataFile, std::ios::binary) << expected;
+  const auto bytes = std::as_bytes(std::span<const char>(expected.data(), expected.size()));
+
+  FileReader reader;
+  auto crc = reader.readWithChecksum(dataFile, ChecksumAlgorithm::Crc32c);
+  ASSERT_TRUE(crc.hasValue());
+  EXPECT_EQ(crc.value().content, expected);
+  EXPECT_EQ(crc.value().checksum, Checksum::crc32c(bytes));
+
+  auto xxh = reader.readWithChecksum(dataFile, ChecksumAlgorithm::XxHash64);
+  ASSERT_TRUE(xxh.hasValue());
+  EXPECT_EQ(xxh.value().checksum, Checksum::xxHash64(bytes));
+
+  auto empty = reader.readWithChecksum(emptyFile_, ChecksumAlgorithm::XxHash64);
+  ASSERT_TRUE(empty.hasValue());
+  EXPECT_TRUE(empty.value().content.empty());
+  EXPECT_EQ(empty.value().checksum, Checksum::xxHash64({}));
+
+  auto missing = reader.readWithChecksum(testDir_ / "missing.bin", ChecksumAlgorithm::Crc32c);
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, dotnamecpp::utils::FileErrorCode::NotFound);
+}
+
+TEST_F(FileReaderTest, HashFileStreamsWithoutBuffering) {
+  FileReader reader;
+  const std::string_view expected = "Line 1\nLine 2\nLine 3\n";
+  const auto bytes = std::as_bytes(std::span<const char>(expected.data(), expected.size()));
+
+  auto crc = reader.hashFile(multiLineFile_, ChecksumAlgorithm::Crc32c,
+                             ReadChunkOptions{.chunkSize = 5});
+  ASSERT_TRUE(crc.hasValue());
+  EXPECT_EQ(crc.value(), Checksum::crc32c(bytes));
+
+  auto xxh = reader.hashFile(multiLineFile_, ChecksumAlgorithm::XxHash64);
+  ASSERT_TRUE(xxh.hasValue());
+  EXPECT_EQ(xxh.value(), Checksum::xxHash64(bytes));
+
+  auto directory = reader.hashFile(testDir_, ChecksumAlgorithm::Crc32c);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, dotnamecpp::utils::FileErrorCode::IsDirectory);
+}
+
+// ============================================================================
+// Read hints and prefetch() tests
+// ============================================================================
+
+TEST_F(FileReaderTest, ReadHintsDoNotChangeContent) {
+  const fs::path dataFile = testDir_ / "hinted.bin";
+  const std::string expected(300 * 1024, 'h');
+  std::ofstream(dataFile, std::ios::binary) << expected;
+
+  // Every whole-file read drops the file from the page cache afterwards
+  FileReader reader(FileReaderOptions{.dropCacheThreshold = 1});
+  EXPECT_EQ(reader.read(dataFile).value(), expected);
+  EXPECT_EQ(reader.readBytes(dataFile).value().size(), expected.size());
+  EXPECT_EQ(reader.readParallel(dataFile).value().size(), expected.size());
+
+  for (const auto pattern : {AccessPattern::Sequential, AccessPattern::Random}) {
+    auto mapped = reader.readMapped(dataFile, ReadHints{.pattern = pattern, .willNeed = true});
+    ASSERT_TRUE(mapped.hasValue());
+    EXPECT_EQ(mapped.value().view(), expected);
+
+    std::string collected;
+    auto result = reader.readChunks(
+        dataFile,
+        [&](std::span<const std::byte> chunk) {
+          collected.append(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+          return true;
+        },
+        ReadChunkOptions{.chunkSize = 64 * 1024,
+                         .readAhead = pattern == AccessPattern::Random,
+                         .hints = {.pattern = pattern, .dropAfterRead = true}});
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(collected, expected);
+  }
+}
+
+TEST_F(FileReaderTest, PrefetchSkipsUnreadableFiles) {
+  FileReader reader;
+  IoThreadPool pool(2);
+  auto done = reader.prefetch({simpleFile_, testDir_ / "missing.txt", testDir_, binaryFile_},
+                              &pool);
+  EXPECT_EQ(done.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+  EXPECT_NO_THROW(done.get());
+  EXPECT_NO_THROW(reader.prefetch({}).get());
+}
+
 // ============================================================================
 // Error handling tests
 // ============================================================================
@@ -314,3 +895,65 @@ TEST_F(FileReaderTest, ResultValueOrWorks) {
   EXPECT_EQ(success.valueOr("default"), "Hello, World!");
   EXPECT_EQ(failure.valueOr("default"), "default");
 }
+
+// ============================================================================
+// Benchmarks (run with --gtest_also_run_disabled_tests --gtest_filter=*Benchmark*)
+// ============================================================================
+
+namespace {
+  // The streambuf-iterator loop readBytes() used before the descriptor-based implementation
+  std::vector<uint8_t> readBytesWithIterators(const fs::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> buffer;
+    buffer.reserve(static_cast<size_t>(fs::file_size(path)));
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return buffer;
+  }
+
+  template <typename Func>
+  double averageMilliseconds(int iterations, Func &&func) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      func();
+    }
+    const std::chrono::duration<double, std::milli> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / iterations;
+  }
+} // namespace
+
+TEST_F(FileReaderTest, DISABLED_BenchmarkReadBytes) {
+  constexpr std::size_t kKiB = 1024;
+  constexpr std::size_t kMiB = 1024 * kKiB;
+  constexpr std::size_t kGiB = 1024 * kMiB;
+
+  FileReader reader;
+  const fs::path benchFile = testDir_ / "bench.bin";
+  const std::vector<char> block(kMiB, 'x');
+
+  for (const std::size_t size : {kKiB, kMiB, kGiB}) {
+    {
+      std::ofstream out(benchFile, std::ios::binary | std::ios::trunc);
+      for (std::size_t written = 0; written < size; written += block.size()) {
+        const std::size_t count = std::min(block.size(), size - written);
+        out.write(block.data(), static_cast<std::streamsize>(count));
+      }
+    }
+
+    const int iterations = size >= kGiB ? 2 : (size >= kMiB ? 50 : 5000);
+    std::size_t checkSize = 0;
+    const double baseline = averageMilliseconds(
+        iterations, [&] { checkSize = readBytesWithIterators(benchFile).size(); });
+    EXPECT_EQ(checkSize, size);
+    const double current =
+        averageMilliseconds(iterations, [&] { checkSize = reader.readBytes(benchFile)->size(); });
+    EXPECT_EQ(checkSize, size);
+    const double text =
+        averageMilliseconds(iterations, [&] { checkSize = reader.read(benchFile)->size(); });
+    EXPECT_EQ(checkSize, size);
+
+    std::printf("%10zu bytes: istreambuf_iterator %9.3f ms, readBytes %9.3f ms, read %9.3f ms\n",
+                size, baseline, current, text);
+  }
+  fs::remove(benchFile);
+}
@@ -0,0 +1,165 @@
+#include <Utils/Filesystem/FileWatcher.hpp>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+using namespace dotnamecpp::utils;
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+class FileWatcherTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    testDir_ = fs::temp_directory_path() / "FileWatcherTest";
+    fs::create_directories(testDir_);
+    file_ = testDir_ / "watched.txt";
+    std::ofstream(file_) << "initial";
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove_all(testDir_, ec);
+  }
+
+  // Collects reported paths of a watcher
+  struct Recorder {
+    std::mutex mutex;
+    std::set<fs::path> paths;
+
+    bool contains(const fs::path &path) {
+      std::lock_guard<std::mutex> lock(mutex);
+      return paths.contains(path);
+    }
+  };
+
+  static void record(FileWatcher &watcher, Recorder &recorder) {
+    watcher.addListener([&recorder](const fs::path &path) {
+      std::lock_guard<std::mutex> lock(recorder.mutex);
+      recorder.paths.insert(path);
+    });
+  }
+
+  static bool waitFor(const std::function<bool()> &condition) {
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(5ms);
+    }
+    return true;
+  }
+
+  void expectModificationReported(FileWatcherOptions options) {
+    FileWatcher watcher(options);
+    Recorder recorder;
+    record(watcher, recorder);
+    ASSERT_TRUE(watcher.watch(file_));
+
+    std::ofstream(file_) << "modified content";
+    EXPECT_TRUE(waitFor([&] { return recorder.contains(FileWatcher::normalize(file_)); }));
+    watcher.unwatch(file_);
+  }
+
+  fs::path testDir_;
+  fs::path file_;
+};
+
+TEST_F(FileWatcherTest, ReportsModification) {
+  expectModificationReported({});
+}
+
+TEST_F(FileWatcherTest, PollingFallbackReportsModification) {
+  expectModificationReported({.pollInterval = 10ms, .forcePolling = true});
+}
+
+TEST_F(FileWatcherTest, ReportsReplacementAndDeletion) {
+  FileWatcher watcher;
+  if (!watcher.usesInotify()) {
+    GTEST_SKIP() << "inotify not available";
+  }
+  Recorder recorder;
+  record(watcher, recorder);
+  const auto other = testDir_ / "other.txt";
+  std::ofstream(other) << "other";
+  ASSERT_TRUE(watcher.watch(file_));
+  ASSERT_TRUE(watcher.watch(other));
+
+  // Atomic replacement does not touch the watched inode, only the directory entry
+  const auto replacement = testDir_ / "replacement.tmp";
+  std::ofstream(replacement) << "replaced";
+  fs::rename(replacement, file_);
+  fs::remove(other);
+
+  EXPECT_TRUE(waitFor([&] {
+    return recorder.contains(FileWatcher::normalize(file_)) &&
+           recorder.contains(FileWatcher::normalize(other));
+  }));
+  EXPECT_FALSE(recorder.contains(FileWatcher::normalize(replacement)));
+}
+
+TEST_F(FileWatcherTest, WatchesAreReferenceCounted) {
+  FileWatcher watcher;
+  ASSERT_TRUE(watcher.watch(file_));
+  ASSERT_TRUE(watcher.watch(testDir_ / "." / "watched.txt"));
+  EXPECT_EQ(watcher.watchedCount(), 1U);
+
+  watcher.unwatch(file_);
+  EXPECT_TRUE(watcher.isWatching(file_));
+  watcher.unwatch(file_);
+  EXPECT_FALSE(watcher.isWatching(file_));
+}
+
+TEST_F(FileWatcherTest, RejectsMissingFilesDirectoriesAndSymlinks) {
+  FileWatcher watcher;
+  EXPECT_FALSE(watcher.watch(testDir_ / "missing.txt"));
+  EXPECT_FALSE(watcher.watch(testDir_));
+
+  std::error_code ec;
+  fs::create_symlink(file_, testDir_ / "link.txt", ec);
+  if (!ec) {
+    EXPECT_FALSE(watcher.watch(testDir_ / "link.txt"));
+  }
+  EXPECT_EQ(watcher.watchedCount(), 0U);
+}
+
+TEST_F(FileWatcherTest, RemovedDirectoryKeepsReferencesUntilUnwatched) {
+  FileWatcher watcher;
+  if (!watcher.usesInotify()) {
+    GTEST_SKIP() << "inotify not available";
+  }
+  Recorder recorder;
+  record(watcher, recorder);
+  const auto key = FileWatcher::normalize(file_);
+  ASSERT_TRUE(watcher.watch(file_));
+  ASSERT_TRUE(watcher.watch(file_));
+
+  fs::remove_all(testDir_);
+  EXPECT_TRUE(waitFor([&] { return recorder.contains(key) && !watcher.isWatching(file_); }));
+
+  // Watching the recreated file again adds to the two references still held
+  fs::create_directories(testDir_);
+  std::ofstream(file_) << "recreated";
+  ASSERT_TRUE(watcher.watch(file_));
+  EXPECT_TRUE(watcher.isWatching(file_));
+  {
+    std::lock_guard<std::mutex> lock(recorder.mutex);
+    recorder.paths.clear();
+  }
+  std::ofstream(file_) << "modified again";
+  EXPECT_TRUE(waitFor([&] { return recorder.contains(key); }));
+
+  watcher.unwatch(file_);
+  watcher.unwatch(file_);
+  EXPECT_TRUE(watcher.isWatching(file_));
+  watcher.unwatch(file_);
+  EXPECT_FALSE(watcher.isWatching(file_));
+  EXPECT_EQ(watcher.watchedCount(), 0U);
+}
@@ -0,0 +1,405 @@
+#include "TempDirectoryTest.hpp"
+#include <Utils/Filesystem/DirectoryCache.hpp>
+#include <Utils/Filesystem/DirectoryManager.hpp>
+#include <Utils/Filesystem/FileWriter.hpp>
+#include <Utils/Filesystem/GroupCommit.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <csignal>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#endif
+
+using namespace dotnamecpp::utils;
+namespace fs = std::filesystem;
+using namespace std::chrono_literals;
+
+class FileWriterTest : public TempDirectoryTest {
+protected:
+  FileWriter writer_;
+};
+
+TEST_F(FileWriterTest, WriteLinesJoinsSmallOutputs) {
+  const auto path = testDir_ / "lines.txt";
+  ASSERT_TRUE(writer_.writeLines(path, std::vector<std::string>{"alpha", "", "gamma"}));
+  EXPECT_EQ(contentOf(path), "alpha\n\ngamma\n");
+
+  const std::vector<std::string_view> more{"delta", "epsilon"};
+  ASSERT_TRUE(writer_.writeLines(path, more, true));
+  EXPECT_EQ(contentOf(path), "alpha\n\ngamma\ndelta\nepsilon\n");
+}
+
+TEST_F(FileWriterTest, WriteLinesGathersLargeOutputs) {
+  // More lines than IOV_MAX and more bytes than are joined into one buffer
+  std::vector<std::string> lines;
+  std::string expected;
+  for (int i = 0; i < 5000; ++i) {
+    lines.emplace_back(static_cast<std::size_t>(i % 200), static_cast<char>('a' + i % 26));
+    expected += lines.back() + '\n';
+  }
+  ASSERT_GT(expected.size(), 256U * 1024U);
+
+  const auto path = testDir_ / "large.txt";
+  ASSERT_TRUE(writer_.writeLines(path, lines));
+  EXPECT_EQ(contentOf(path), expected);
+
+  const std::vector<std::string_view> views(lines.begin(), lines.end());
+  ASSERT_TRUE(writer_.writeLines(path, views));
+  EXPECT_EQ(contentOf(path), expected);
+}
+
+TEST_F(FileWriterTest, WriteBytesPreallocatesAndAppends) {
+  const auto path = testDir_ / "data.bin";
+  std::vector<uint8_t> data(1024 * 1024);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<uint8_t>(i * 13);
+  }
+
+  ASSERT_TRUE(writer_.writeBytes(path, data, WriteOptions{.preallocate = true}));
+  EXPECT_EQ(fs::file_size(path), data.size());
+  ASSERT_TRUE(writer_.writeBytes(path, std::span(data).first(10),
+                                 WriteOptions{.append = true, .preallocate = true}));
+
+  const std::string content = contentOf(path);
+  ASSERT_EQ(content.size(), data.size() + 10);
+  EXPECT_TRUE(std::equal(data.begin(), data.end(), content.begin(),
+                         [](uint8_t a, char b) { return a == static_cast<uint8_t>(b); }));
+  EXPECT_EQ(static_cast<uint8_t>(content.back()), data[9]);
+}
+
+TEST_F(FileWriterTest, SparseWriteLeavesZeroBlocksAsHoles) {
+  const auto path = testDir_ / "sparse.bin";
+  std::vector<uint8_t> data(8 * 1024 * 1024);
+  data[5] = 1;
+  data[3 * 1024 * 1024 + 7] = 2; // Zero tail: the size must still cover it
+
+  ASSERT_TRUE(writer_.writeBytes(path, data, WriteOptions{.sparse = true}));
+  ASSERT_TRUE(writer_.writeBytes(path, std::vector<uint8_t>(8192),
+                                 WriteOptions{.append = true, .sparse = true}));
+
+  const std::string content = contentOf(path);
+  ASSERT_EQ(content.size(), data.size() + 8192);
+  EXPECT_EQ(content[5], 1);
+  EXPECT_EQ(content[(3 * 1024 * 1024) + 7], 2);
+  EXPECT_EQ(std::count(content.begin(), content.end(), '\0'),
+            static_cast<std::ptrdiff_t>(content.size() - 2));
+
+#ifndef _WIN32
+  struct stat info{};
+  ASSERT_EQ(::stat(path.c_str(), &info), 0);
+  EXPECT_LT(static_cast<std::uintmax_t>(info.st_blocks) * 512, content.size() / 2);
+#endif
+}
+
+TEST_F(FileWriterTest, DurableWritesReplaceAtomicallyAndShareSyncs) {
+  const auto path = testDir_ / "state" / "state.bin";
+  const std::vector<uint8_t> initial{1, 2, 3};
+  const std::vector<uint8_t> replacement{4, 5};
+  ASSERT_TRUE(writer_.writeBytes(path, initial, WriteOptions{.durable = true}));
+  ASSERT_TRUE(writer_.writeBytes(path, replacement, WriteOptions{.durable = true}));
+  EXPECT_EQ(contentOf(path), std::string("\x04\x05"));
+  // No temporary files are left behind
+  EXPECT_EQ(std::distance(fs::directory_iterator(path.parent_path()), fs::directory_iterator()),
+            1);
+
+  const auto log = testDir_ / "journal.bin";
+  constexpr int kThreads = 8;
+  constexpr int kRecords = 25;
+#ifndef _WIN32
+  const auto syncsBefore = GroupCommit::shared().syncCount();
+#endif
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([this, &log, t] {
+      const std::vector<uint8_t> record(16, static_cast<uint8_t>('a' + t));
+      for (int i = 0; i < kRecords; ++i) {
+        EXPECT_TRUE(writer_.writeBytes(log, record, WriteOptions{.append = true, .durable = true}));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(fs::file_size(log), 16U * kThreads * kRecords);
+#ifndef _WIN32
+  // Every durable append went through GroupCommit; how concurrent callers share syncs is
+  // checked deterministically in GroupCommitTest
+  EXPECT_GT(GroupCommit::shared().syncCount(), syncsBefore);
+#endif
+}
+
+TEST_F(FileWriterTest, AppenderBuffersUntilFlush) {
+  const auto path = testDir_ / "nested" / "log.txt";
+  auto appender = writer_.openAppender(path, {.bufferSize = 1024, .flushInterval = 0ms});
+  ASSERT_TRUE(appender);
+  auto &handle = *appender.value();
+
+  ASSERT_TRUE(handle.append("first "));
+  ASSERT_TRUE(handle.appendLine("line"));
+  EXPECT_EQ(handle.pendingBytes(), 11U);
+  EXPECT_EQ(contentOf(path), "");
+
+  ASSERT_TRUE(handle.flush());
+  EXPECT_EQ(handle.pendingBytes(), 0U);
+  EXPECT_EQ(contentOf(path), "first line\n");
+}
+
+TEST_F(FileWriterTest, AppenderFlushesWhenBufferFills) {
+  const auto path = testDir_ / "log.txt";
+  ASSERT_TRUE(writer_.write(path, "existing\n"));
+  auto appender = writer_.openAppender(path, {.bufferSize = 16, .flushInterval = 0ms});
+  ASSERT_TRUE(appender);
+  auto &handle = *appender.value();
+
+  ASSERT_TRUE(handle.append("0123456789"));
+  EXPECT_EQ(contentOf(path), "existing\n");
+  ASSERT_TRUE(handle.append("abcdefghij"));
+  EXPECT_EQ(contentOf(path), "existing\n0123456789abcdefghij");
+
+  // Appends larger than the buffer bypass it
+  const std::string large(100, 'x');
+  ASSERT_TRUE(handle.append(large));
+  EXPECT_EQ(handle.pendingBytes(), 0U);
+  EXPECT_EQ(contentOf(path), "existing\n0123456789abcdefghij" + large);
+}
+
+#ifdef __linux__
+TEST_F(FileWriterTest, AppenderKeepsTheTailOfAShortDirectWrite) {
+  const auto path = testDir_ / "limited.log";
+  auto appender = writer_.openAppender(path, {.bufferSize = 1024, .flushInterval = 0ms});
+  ASSERT_TRUE(appender);
+  auto &handle = *appender.value();
+
+  // A file size limit makes the large, unbuffered append stop after 1000 bytes
+  std::string large(4096, 'x');
+  for (std::size_t i = 0; i < large.size(); ++i) {
+    large[i] = static_cast<char>('a' + i % 26);
+  }
+  const auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+  rlimit limit{};
+  ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &limit), 0);
+  const rlimit previous = limit;
+  limit.rlim_cur = 1000;
+  ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limit), 0);
+  const auto failed = handle.append(large);
+  ::setrlimit(RLIMIT_FSIZE, &previous);
+  std::signal(SIGXFSZ, previousHandler);
+
+  ASSERT_FALSE(failed.hasValue());
+  EXPECT_EQ(fs::file_size(path), 1000U);
+  EXPECT_EQ(handle.pendingBytes(), large.size() - 1000);
+
+  // The tail is written before anything appended later
+  ASSERT_TRUE(handle.append("end"));
+  ASSERT_TRUE(handle.flush());
+  EXPECT_EQ(contentOf(path), large + "end");
+}
+
+TEST_F(FileWriterTest, AppendAfterAFailedBackgroundFlushIsStillBuffered) {
+  const auto path = testDir_ / "limited.log";
+  auto appender = writer_.openAppender(path, {.bufferSize = 1024, .flushInterval = 10ms});
+  ASSERT_TRUE(appender);
+  auto &handle = *appender.value();
+
+  // With a file size limit of zero every background flush fails
+  const auto previousHandler = std::signal(SIGXFSZ, SIG_IGN);
+  rlimit limit{};
+  ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &limit), 0);
+  const rlimit previous = limit;
+  limit.rlim_cur = 0;
+  ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limit), 0);
+  ASSERT_TRUE(handle.appendLine("first"));
+  std::this_thread::sleep_for(200ms);
+  ::setrlimit(RLIMIT_FSIZE, &previous);
+  std::signal(SIGXFSZ, previousHandler);
+
+  // The earlier failure is reported, but the new line is not lost
+  EXPECT_FALSE(handle.appendLine("second").hasValue());
+  ASSERT_TRUE(handle.flush());
+  EXPECT_EQ(contentOf(path), "first\nsecond\n");
+}
+#endif
+
+TEST_F(FileWriterTest, AppenderFlushesAfterInterval) {
+  const auto path = testDir_ / "log.txt";
+  auto appender = writer_.openAppender(path, {.bufferSize = 1024, .flushInterval = 20ms});
+  ASSERT_TRUE(appender);
+  ASSERT_TRUE(appender.value()->appendLine("tick"));
+
+  const auto deadline = std::chrono::steady_clock::now() + 5s;
+  while (contentOf(path).empty() && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(5ms);
+  }
+  EXPECT_EQ(contentOf(path), "tick\n");
+}
+
+TEST_F(FileWriterTest, AppenderFlushesOnDestructionAndKeepsAppendsWhole) {
+  const auto path = testDir_ / "log.txt";
+  const std::string record(50, 'r');
+  {
+    auto appender = writer_.openAppender(path, {.bufferSize = 256, .flushInterval = 1ms});
+    ASSERT_TRUE(appender);
+    auto &handle = *appender.value();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&handle, &record] {
+        for (int i = 0; i < 100; ++i) {
+          EXPECT_TRUE(handle.appendLine(record));
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::ifstream file(path);
+  std::size_t lines = 0;
+  for (std::string line; std::getline(file, line); ++lines) {
+    EXPECT_EQ(line, record);
+  }
+  EXPECT_EQ(lines, 400U);
+}
+
+TEST_F(FileWriterTest, OpenAppenderRejectsDirectory) {
+  auto appender = writer_.openAppender(testDir_);
+  ASSERT_FALSE(appender.hasValue());
+  EXPECT_EQ(appender.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileWriterTest, WritesRecreateRemovedParentDirectories) {
+  const auto nested = testDir_ / "out" / "a" / "b";
+  ASSERT_TRUE(writer_.write(nested / "one.txt", "one"));
+  EXPECT_EQ(contentOf(nested / "one.txt"), "one");
+
+  // Removal through DirectoryManager invalidates the cached directories
+  DirectoryManager directories;
+  DirectoryCache::shared().insert(nested);
+  ASSERT_TRUE(directories.removeDirectoryRecursive(testDir_ / "out"));
+  EXPECT_FALSE(DirectoryCache::shared().contains(nested));
+  ASSERT_TRUE(writer_.writeLines(nested / "two.txt", std::vector<std::string>{"two"}));
+  EXPECT_EQ(contentOf(nested / "two.txt"), "two\n");
+
+  // A stale entry for a directory removed elsewhere is dropped once the open fails
+  DirectoryCache::shared().insert(nested);
+  fs::remove_all(testDir_ / "out");
+  const std::vector<uint8_t> bytes{1, 2, 3};
+  ASSERT_TRUE(writer_.writeBytes(nested / "three.bin", bytes));
+  EXPECT_EQ(fs::file_size(nested / "three.bin"), 3U);
+
+  auto result = writer_.write(nested, "not a file");
+  ASSERT_FALSE(result.hasValue());
+  EXPECT_EQ(result.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileWriterTest, AppenderCopyAndTouchRecreateRemovedParentDirectories) {
+  const auto source = testDir_ / "source.bin";
+  ASSERT_TRUE(writer_.write(source, "copied"));
+  const auto nested = testDir_ / "sub";
+  ASSERT_TRUE(writer_.write(nested / "first.txt", "first"));
+  ASSERT_TRUE(DirectoryCache::shared().contains(nested));
+
+  fs::remove_all(nested);
+  auto appender = writer_.openAppender(nested / "x.log");
+  ASSERT_TRUE(appender.hasValue());
+  ASSERT_TRUE(appender.value()->append("record\n"));
+  ASSERT_TRUE(appender.value()->flush());
+  EXPECT_EQ(contentOf(nested / "x.log"), "record\n");
+
+  fs::remove_all(nested);
+  ASSERT_TRUE(writer_.copyFile(source, nested / "y.bin"));
+  EXPECT_EQ(contentOf(nested / "y.bin"), "copied");
+
+  fs::remove_all(nested);
+  ASSERT_TRUE(writer_.touch(nested / "z.txt"));
+  EXPECT_TRUE(fs::exists(nested / "z.txt"));
+
+  // A missing source is not mistaken for a missing destination directory
+  auto missing = writer_.copyFile(testDir_ / "missing.bin", testDir_ / "none" / "y.bin");
+  ASSERT_FALSE(missing.hasValue());
+  EXPECT_EQ(missing.error().code, FileErrorCode::NotFound);
+  EXPECT_FALSE(fs::exists(testDir_ / "none"));
+}
+
+TEST_F(FileWriterTest, MappedOutputCommitsTheLengthProduced) {
+  const auto path = testDir_ / "export" / "data.bin";
+  auto opened = writer_.openMapped(path, 1 << 20);
+  ASSERT_TRUE(opened);
+  auto output = std::move(opened).value();
+  ASSERT_EQ(output.bytes().size(), 1U << 20);
+
+  const std::string_view header = "payload";
+  std::memcpy(output.bytes().data(), header.data(), header.size());
+  ASSERT_TRUE(output.sync());
+  ASSERT_FALSE(output.commit(output.capacity() + 1).hasValue());
+  ASSERT_TRUE(output.commit(header.size(), true));
+  EXPECT_TRUE(output.bytes().empty());
+  EXPECT_FALSE(output.commit(0).hasValue());
+  EXPECT_EQ(contentOf(path), header);
+
+  // An output abandoned before commit() leaves no partial file behind
+  {
+    auto abandoned = writer_.openMapped(testDir_ / "partial.bin", 4096);
+    ASSERT_TRUE(abandoned);
+    EXPECT_FALSE(fs::exists(testDir_ / "partial.bin"));
+  }
+  EXPECT_FALSE(fs::exists(testDir_ / "partial.bin"));
+  EXPECT_EQ(std::distance(fs::directory_iterator(testDir_), fs::directory_iterator()), 1);
+
+  auto directory = writer_.openMapped(testDir_, 16);
+  ASSERT_FALSE(directory.hasValue());
+  EXPECT_EQ(directory.error().code, FileErrorCode::IsDirectory);
+}
+
+TEST_F(FileWriterTest, MappedOutputReplacesAnExistingFileOnlyOnCommit) {
+  const auto path = testDir_ / "keep.bin";
+  ASSERT_TRUE(writer_.write(path, "precious"));
+  fs::permissions(path, fs::perms::owner_read | fs::perms::owner_write);
+
+  // Abandoned: the old content survives
+  {
+    auto abandoned = writer_.openMapped(path, 4096);
+    ASSERT_TRUE(abandoned);
+    EXPECT_EQ(contentOf(path), "precious");
+  }
+  EXPECT_EQ(contentOf(path), "precious");
+
+  auto opened = writer_.openMapped(path, 4096);
+  ASSERT_TRUE(opened);
+  auto output = std::move(opened).value();
+  std::memcpy(output.bytes().data(), "new", 3);
+  EXPECT_EQ(contentOf(path), "precious");
+  ASSERT_TRUE(output.commit(3));
+  EXPECT_EQ(contentOf(path), "new");
+  EXPECT_EQ(fs::status(path).permissions() & fs::perms::all,
+            fs::perms::owner_read | fs::perms::owner_write);
+  EXPECT_EQ(std::distance(fs::directory_iterator(testDir_), fs::directory_iterator()), 1);
+}
+
+TEST_F(FileWriterTest, MappedOutputCommitCanBeRetried) {
+  const auto path = testDir_ / "retry.bin";
+  auto opened = writer_.openMapped(path, 4096);
+  ASSERT_TRUE(opened);
+  auto output = std::move(opened).value();
+  std::memcpy(output.bytes().data(), "payload", 7);
+
+  // A non-empty directory in the way makes replacing the target fail
+  fs::create_directories(path / "blocker");
+  ASSERT_FALSE(output.commit(7).hasValue());
+
+  fs::remove_all(path);
+  ASSERT_TRUE(output.commit(7));
+  EXPECT_EQ(contentOf(path), "payload");
+}
@@ -0,0 +1,133 @@
+#ifndef _WIN32
+
+#include <Utils/Filesystem/FileDescriptor.hpp>
+#include <Utils/Filesystem/GroupCommit.hpp>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace dotnamecpp::utils;
+namespace fs = std::filesystem;
+
+namespace {
+
+  // Sync function that holds the first sync until released and can fail it
+  class HeldSync {
+  public:
+    explicit HeldSync(int firstResult) : firstResult_(firstResult) {}
+
+    int operator()(int /*fd*/, bool /*metadata*/) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      const bool first = calls_++ == 0;
+      entered_.notify_all();
+      if (!first) {
+        return 0;
+      }
+      released_.wait(lock, [this] { return !held_; });
+      return firstResult_;
+    }
+
+    void waitUntilEntered() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      entered_.wait(lock, [this] { return calls_ > 0; });
+    }
+
+    void release() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        held_ = false;
+      }
+      released_.notify_all();
+    }
+
+  private:
+    std::mutex mutex_;
+    std::condition_variable entered_;
+    std::condition_variable released_;
+    int calls_ = 0;
+    bool held_ = true;
+    int firstResult_;
+  };
+
+} // namespace
+
+class GroupCommitTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    path_ = fs::temp_directory_path() / "GroupCommitTest.bin";
+    fd_ = FileDescriptor::open(path_, O_WRONLY | O_CREAT | O_TRUNC);
+    ASSERT_TRUE(fd_);
+  }
+
+  void TearDown() override {
+    fd_.reset();
+    std::error_code ec;
+    fs::remove(path_, ec);
+  }
+
+  // Start a leader blocked inside the held sync, then kWaiters callers queuing behind it
+  template <typename Results>
+  std::vector<std::thread> startCallers(GroupCommit &groupCommit, HeldSync &held,
+                                        Results &results) {
+    std::vector<std::thread> threads;
+    threads.emplace_back([&] { results[0] = groupCommit.sync(fd_.get()); });
+    held.waitUntilEntered();
+    for (std::size_t i = 1; i < results.size(); ++i) {
+      threads.emplace_back([&, i] { results[i] = groupCommit.sync(fd_.get()); });
+    }
+    // Give the waiters time to take their tickets while the first sync is in flight
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    return threads;
+  }
+
+  fs::path path_;
+  FileDescriptor fd_;
+};
+
+TEST_F(GroupCommitTest, CallersArrivingDuringASyncShareTheNextOne) {
+  HeldSync held(0);
+  GroupCommit groupCommit([&held](int fd, bool metadata) { return held(fd, metadata); });
+  std::array<int, 16> results{};
+  results.fill(-1);
+
+  auto threads = startCallers(groupCommit, held, results);
+  held.release();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  for (const int result : results) {
+    EXPECT_EQ(result, 0);
+  }
+  // The held sync plus one for all 15 waiters
+  EXPECT_EQ(groupCommit.syncCount(), 2U);
+}
+
+TEST_F(GroupCommitTest, SuccessAfterAFailedSyncIsNotReportedAsDurable) {
+  HeldSync held(EIO);
+  GroupCommit groupCommit([&held](int fd, bool metadata) { return held(fd, metadata); });
+  std::array<int, 8> results{};
+  results.fill(-1);
+
+  auto threads = startCallers(groupCommit, held, results);
+  held.release();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  // The waiters' own sync succeeds, but pages of the failed one may be lost for good
+  for (const int result : results) {
+    EXPECT_EQ(result, EIO);
+  }
+
+  // Once every caller has returned, the file starts over with a fresh group
+  EXPECT_EQ(groupCommit.sync(fd_.get()), 0);
+}
+
+#endif // _WIN32
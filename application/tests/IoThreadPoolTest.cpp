@@ -0,0 +1,36 @@
+#include <Utils/Filesystem/IoThreadPool.hpp>
+#include <atomic>
+#include <future>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace dotnamecpp::utils;
+
+TEST(IoThreadPoolTest, SubmitReturnsResults) {
+  IoThreadPool pool(3);
+  EXPECT_EQ(pool.size(), 3U);
+
+  std::vector<std::future<int>> results;
+  for (int i = 0; i < 100; ++i) {
+    results.push_back(pool.submit([i] { return i * i; }));
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(results[static_cast<std::size_t>(i)].get(), i * i);
+  }
+}
+
+TEST(IoThreadPoolTest, DestructorRunsQueuedTasks) {
+  std::atomic<int> executed{0};
+  {
+    IoThreadPool pool(2);
+    for (int i = 0; i < 50; ++i) {
+      pool.post([&executed] { executed.fetch_add(1); });
+    }
+  }
+  EXPECT_EQ(executed.load(), 50);
+}
+
+TEST(IoThreadPoolTest, SharedPoolHasWorkers) {
+  EXPECT_GE(IoThreadPool::shared().size(), 2U);
+  EXPECT_EQ(IoThreadPool::shared().submit([] { return 42; }).get(), 42);
+}
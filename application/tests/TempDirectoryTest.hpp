@@ -0,0 +1,41 @@
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <system_error>
+
+/**
+ * @brief Test fixture owning a fresh directory under the system temp directory
+ *
+ * The directory is named after the test suite, emptied before each test and removed after it.
+ */
+class TempDirectoryTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    const auto *info = ::testing::UnitTest::GetInstance()->current_test_info();
+    testDir_ = std::filesystem::temp_directory_path() / info->test_suite_name();
+    std::error_code ec;
+    std::filesystem::remove_all(testDir_, ec);
+    std::filesystem::create_directories(testDir_);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    std::filesystem::remove_all(testDir_, ec);
+  }
+
+  /**
+   * @brief Whole content of a file, empty when it cannot be read
+   */
+  static std::string contentOf(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    std::ostringstream content;
+    content << file.rdbuf();
+    return content.str();
+  }
+
+  std::filesystem::path testDir_;
+};
@@ -0,0 +1,212 @@
+#ifndef _WIN32
+
+#include "../../src/Utils/Logger/UnixSocketLogger.hpp"
+#include <Utils/Logger/LoggerFactory.hpp>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <poll.h>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace dotnamecpp::logging;
+namespace fs = std::filesystem;
+
+/**
+ * @brief In-process stand-in for the local collector daemon
+ *
+ */
+class TestCollector {
+public:
+  explicit TestCollector(const fs::path &path) : path_(path) {
+    fd_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path_.c_str());
+    bound_ = ::bind(fd_, reinterpret_cast<const sockaddr *>(&addr), sizeof(addr)) == 0;
+  }
+
+  ~TestCollector() {
+    ::close(fd_);
+    std::error_code ec;
+    fs::remove(path_, ec);
+  }
+
+  TestCollector(const TestCollector &) = delete;
+  TestCollector &operator=(const TestCollector &) = delete;
+  TestCollector(TestCollector &&) = delete;
+  TestCollector &operator=(TestCollector &&) = delete;
+
+  [[nodiscard]]
+  bool isBound() const {
+    return bound_;
+  }
+
+  // Receive one datagram, empty string on timeout
+  std::string receive(int timeoutMs = 1000) {
+    pollfd pfd{.fd = fd_, .events = POLLIN, .revents = 0};
+    if (::poll(&pfd, 1, timeoutMs) <= 0) {
+      return {};
+    }
+    std::string buffer(64 * 1024, '\0');
+    const auto received = ::recv(fd_, buffer.data(), buffer.size(), 0);
+    buffer.resize(received > 0 ? static_cast<size_t>(received) : 0);
+    return buffer;
+  }
+
+private:
+  fs::path path_;
+  int fd_ = -1;
+  bool bound_ = false;
+};
+
+class UnixSocketLoggerTest : public ::testing::Test {
+protected:
+  void SetUp() override {
+    socketPath_ = fs::temp_directory_path() / ("dotname_collector_" + std::to_string(::getpid()));
+    std::error_code ec;
+    fs::remove(socketPath_, ec);
+  }
+
+  void TearDown() override {
+    std::error_code ec;
+    fs::remove(socketPath_, ec);
+  }
+
+  fs::path socketPath_;
+};
+
+TEST_F(UnixSocketLoggerTest, SendsRecordToCollector) {
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+
+  UnixSocketLogger logger(socketPath_.string(), 1);
+  ASSERT_TRUE(logger.isOpen());
+  logger.info("hello collector", "SocketTest");
+
+  auto datagram = collector.receive();
+  EXPECT_NE(datagram.find("[INF][SocketTest] hello collector\n"), std::string::npos);
+  EXPECT_EQ(logger.pendingCount(), 0);
+}
+
+TEST_F(UnixSocketLoggerTest, BatchesRecordsIntoOneDatagram) {
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+
+  UnixSocketLogger logger(socketPath_.string(), 3);
+  logger.setFlushInterval(std::chrono::hours(1));
+  logger.info("first");
+  logger.info("second");
+  EXPECT_EQ(logger.pendingCount(), 2);
+  logger.info("third");
+
+  auto datagram = collector.receive();
+  EXPECT_NE(datagram.find("first\n"), std::string::npos);
+  EXPECT_NE(datagram.find("second\n"), std::string::npos);
+  EXPECT_NE(datagram.find("third\n"), std::string::npos);
+  EXPECT_EQ(logger.pendingCount(), 0);
+}
+
+TEST_F(UnixSocketLoggerTest, ErrorsFlushImmediately) {
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+
+  UnixSocketLogger logger(socketPath_.string(), 100);
+  logger.setFlushInterval(std::chrono::hours(1));
+  logger.info("queued");
+  logger.error("urgent");
+
+  auto datagram = collector.receive();
+  EXPECT_NE(datagram.find("queued\n"), std::string::npos);
+  EXPECT_NE(datagram.find("[ERR] urgent\n"), std::string::npos);
+}
+
+TEST_F(UnixSocketLoggerTest, PartialBatchIsSentAfterFlushInterval) {
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+
+  UnixSocketLogger logger(socketPath_.string(), 100);
+  logger.setFlushInterval(std::chrono::milliseconds(50));
+  logger.info("trailing record");
+
+  // No further record, flush() or destruction is needed to ship it
+  EXPECT_NE(collector.receive(2000).find("trailing record\n"), std::string::npos);
+  EXPECT_EQ(logger.pendingCount(), 0);
+}
+
+TEST_F(UnixSocketLoggerTest, KeepsRecordsUntilCollectorAppears) {
+  UnixSocketLogger logger(socketPath_.string(), 1);
+  logger.info("early record");
+  EXPECT_EQ(logger.pendingCount(), 1);
+
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+  EXPECT_TRUE(logger.flush());
+
+  EXPECT_NE(collector.receive().find("early record"), std::string::npos);
+}
+
+TEST_F(UnixSocketLoggerTest, ZeroIntervalWithoutCollectorDoesNotSpin) {
+  UnixSocketLogger logger(socketPath_.string(), 100);
+  logger.setFlushInterval(std::chrono::milliseconds(0));
+  logger.info("undeliverable record");
+  EXPECT_EQ(logger.pendingCount(), 1);
+
+  // A flusher retrying without a pause would burn the whole wait in CPU time
+  const std::clock_t start = std::clock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  const double cpuMs = 1000.0 * static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+  EXPECT_LT(cpuMs, 25.0);
+  EXPECT_EQ(logger.pendingCount(), 1);
+}
+
+TEST_F(UnixSocketLoggerTest, RetryQueueIsBounded) {
+  UnixSocketLogger logger(socketPath_.string(), 1, 2);
+  for (int i = 0; i < 5; ++i) {
+    logger.info("record " + std::to_string(i));
+  }
+
+  EXPECT_EQ(logger.pendingCount(), 2);
+  EXPECT_EQ(logger.droppedCount(), 3);
+
+  // Oldest records were dropped, newest are delivered
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+  EXPECT_TRUE(logger.flush());
+  EXPECT_NE(collector.receive().find("record 3"), std::string::npos);
+  EXPECT_NE(collector.receive().find("record 4"), std::string::npos);
+}
+
+TEST_F(UnixSocketLoggerTest, LevelFiltering) {
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+
+  UnixSocketLogger logger(socketPath_.string(), 1);
+  logger.setLevel(Level::LOG_WARNING);
+  logger.info("filtered out");
+  EXPECT_EQ(logger.pendingCount(), 0);
+  EXPECT_TRUE(collector.receive(50).empty());
+}
+
+TEST_F(UnixSocketLoggerTest, CreatedThroughFactory) {
+  TestCollector collector(socketPath_);
+  ASSERT_TRUE(collector.isBound());
+
+  LoggerConfig config;
+  config.appPrefix = "FactoryApp";
+  config.socketPath = socketPath_.string();
+  config.socketBatchSize = 1;
+  auto logger = LoggerFactory::create(LoggerType::UnixSocket, config);
+  ASSERT_NE(logger, nullptr);
+
+  logger->infoStream() << "via factory " << 42;
+  EXPECT_NE(collector.receive().find("[FactoryApp]"), std::string::npos);
+}
+
+#endif // _WIN32
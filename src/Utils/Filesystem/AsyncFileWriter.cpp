@@ -0,0 +1,255 @@
+#include "AsyncFileWriter.hpp"
+#include <stdexcept>
+#include <utility>
+
+namespace dotnamecpp::utils {
+
+  namespace {
+
+    template <typename Lines>
+    std::string joinLines(const Lines &lines) {
+      std::size_t size = 0;
+      for (const auto &line : lines) {
+        size += line.size() + 1;
+      }
+      std::string joined;
+      joined.reserve(size);
+      for (const auto &line : lines) {
+        joined.append(line);
+        joined.push_back('\n');
+      }
+      return joined;
+    }
+
+    std::optional<FileError> checkPath(const std::filesystem::path &filePath) {
+      if (filePath.empty()) {
+        return FileError{
+            .code = FileErrorCode::InvalidPath,
+            .message = "Empty file path",
+            .path = "",
+        };
+      }
+      return std::nullopt;
+    }
+
+    WriteOptions appending(bool append) {
+      WriteOptions options;
+      options.append = append;
+      return options;
+    }
+
+    // Same allocation and durability, so the two writes can be applied as one
+    bool sameLayout(const WriteOptions &a, const WriteOptions &b) {
+      return a.preallocate == b.preallocate && a.sparse == b.sparse &&
+             a.sparseBlockSize == b.sparseBlockSize && a.durable == b.durable;
+    }
+
+  } // namespace
+
+  AsyncFileWriter::AsyncFileWriter(std::shared_ptr<IFileWriter> inner, AsyncWriterOptions options)
+      : inner_(std::move(inner)), options_(std::move(options)) {
+    if (!inner_) {
+      throw std::invalid_argument("AsyncFileWriter requires a writer");
+    }
+    worker_ = std::thread([this] { run(); });
+  }
+
+  AsyncFileWriter::~AsyncFileWriter() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    workAvailable_.notify_one();
+    worker_.join();
+  }
+
+  Result<void, FileError> AsyncFileWriter::write(const std::filesystem::path &filePath,
+                                                 const std::string &content, bool append) const {
+    return enqueueDetached(Operation(Kind::Text, filePath, content, appending(append)));
+  }
+
+  Result<void, FileError> AsyncFileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                      const std::vector<uint8_t> &data,
+                                                      bool append) const {
+    return enqueueDetached(Operation(Kind::Binary, filePath, std::string(data.begin(), data.end()),
+                                     appending(append)));
+  }
+
+  Result<void, FileError> AsyncFileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                      std::span<const uint8_t> data,
+                                                      const WriteOptions &options) const {
+    return enqueueDetached(
+        Operation(Kind::Binary, filePath, std::string(data.begin(), data.end()), options));
+  }
+
+  Result<void, FileError> AsyncFileWriter::writeLines(const std::filesystem::path &filePath,
+                                                      const std::vector<std::string> &lines,
+                                                      bool append) const {
+    return enqueueDetached(Operation(Kind::Text, filePath, joinLines(lines), appending(append)));
+  }
+
+  Result<void, FileError> AsyncFileWriter::writeLines(const std::filesystem::path &filePath,
+                                                      std::span<const std::string_view> lines,
+                                                      bool append) const {
+    return enqueueDetached(Operation(Kind::Text, filePath, joinLines(lines), appending(append)));
+  }
+
+  Result<void, FileError> AsyncFileWriter::touch(const std::filesystem::path &filePath) const {
+    drain();
+    return inner_->touch(filePath);
+  }
+
+  Result<CopyStats, FileError> AsyncFileWriter::copyFile(const std::filesystem::path &source,
+                                                         const std::filesystem::path &destination,
+                                                         const CopyOptions &options) const {
+    drain();
+    return inner_->copyFile(source, destination, options);
+  }
+
+  Result<std::unique_ptr<IFileAppender>, FileError>
+      AsyncFileWriter::openAppender(const std::filesystem::path &filePath,
+                                    const AppenderOptions &options) const {
+    drain();
+    return inner_->openAppender(filePath, options);
+  }
+
+  Result<MappedOutput, FileError> AsyncFileWriter::openMapped(const std::filesystem::path &filePath,
+                                                              std::size_t capacity) const {
+    drain();
+    return inner_->openMapped(filePath, capacity);
+  }
+
+  std::future<Result<void, FileError>>
+      AsyncFileWriter::writeAsync(const std::filesystem::path &filePath, std::string content,
+                                  bool append) const {
+    return enqueue(Operation(Kind::Text, filePath, std::move(content), appending(append)), true);
+  }
+
+  std::future<Result<void, FileError>>
+      AsyncFileWriter::writeBytesAsync(const std::filesystem::path &filePath,
+                                       std::vector<uint8_t> data,
+                                       const WriteOptions &options) const {
+    return enqueue(
+        Operation(Kind::Binary, filePath, std::string(data.begin(), data.end()), options), true);
+  }
+
+  void AsyncFileWriter::drain() const {
+    std::unique_lock<std::mutex> lock(mutex_);
+    const std::uint64_t target = enqueued_;
+    progress_.wait(lock, [&] { return completed_ >= target; });
+  }
+
+  std::size_t AsyncFileWriter::queuedBytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queuedBytes_;
+  }
+
+  Result<void, FileError> AsyncFileWriter::enqueueDetached(Operation operation) const {
+    if (auto error = checkPath(operation.path)) {
+      return *error;
+    }
+    [[maybe_unused]] auto unobserved = enqueue(std::move(operation), false);
+    return {};
+  }
+
+  std::future<Result<void, FileError>> AsyncFileWriter::enqueue(Operation operation,
+                                                                bool observe) const {
+    std::future<Result<void, FileError>> future;
+    if (auto error = checkPath(operation.path)) {
+      std::promise<Result<void, FileError>> failed;
+      failed.set_value(*error);
+      return failed.get_future();
+    }
+    if (observe) {
+      operation.promises.emplace_back();
+      future = operation.promises.back().get_future();
+    }
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (options_.maxQueuedBytes > 0) {
+        // A write larger than the whole budget still goes through once the queue is empty
+        progress_.wait(lock, [&] {
+          return queuedBytes_ == 0 ||
+                 queuedBytes_ + operation.queuedBytes <= options_.maxQueuedBytes;
+        });
+      }
+      queuedBytes_ += operation.queuedBytes;
+      ++enqueued_;
+      queue_.push_back(std::move(operation));
+    }
+    workAvailable_.notify_one();
+    return future;
+  }
+
+  std::vector<AsyncFileWriter::Operation>
+      AsyncFileWriter::coalesce(std::deque<Operation> &batch) {
+    std::vector<Operation> merged;
+    merged.reserve(batch.size());
+    for (auto &operation : batch) {
+      if (!merged.empty()) {
+        auto &last = merged.back();
+        if (last.path == operation.path && last.kind == operation.kind &&
+            sameLayout(last.options, operation.options)) {
+          auto promises = std::move(operation.promises);
+          if (operation.options.append) {
+            last.data.append(operation.data);
+          } else {
+            // Truncates the file, so the previous write would be overwritten anyway
+            last.data = std::move(operation.data);
+            last.options = operation.options;
+          }
+          last.queuedBytes += operation.queuedBytes;
+          last.count += operation.count;
+          for (auto &promise : promises) {
+            last.promises.push_back(std::move(promise));
+          }
+          continue;
+        }
+      }
+      merged.push_back(std::move(operation));
+    }
+    return merged;
+  }
+
+  Result<void, FileError> AsyncFileWriter::apply(const Operation &operation) const {
+    if (operation.kind == Kind::Text) {
+      return inner_->write(operation.path, operation.data, operation.options.append);
+    }
+    const std::span<const uint8_t> data(reinterpret_cast<const uint8_t *>(operation.data.data()),
+                                        operation.data.size());
+    return inner_->writeBytes(operation.path, data, operation.options);
+  }
+
+  void AsyncFileWriter::run() {
+    for (;;) {
+      std::deque<Operation> batch;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        workAvailable_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return; // Stopping, and everything queued has been applied
+        }
+        batch.swap(queue_);
+      }
+
+      for (auto &operation : coalesce(batch)) {
+        auto result = apply(operation);
+        if (!result && options_.onError) {
+          options_.onError(result.error());
+        }
+        for (auto &promise : operation.promises) {
+          promise.set_value(result);
+        }
+
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          queuedBytes_ -= operation.queuedBytes;
+          completed_ += operation.count;
+        }
+        progress_.notify_all();
+      }
+    }
+  }
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <Utils/Filesystem/IFileWriter.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Configuration of AsyncFileWriter
+   *
+   */
+  struct AsyncWriterOptions {
+    // Enqueueing blocks while this many bytes wait to be written, 0 = unbounded
+    std::size_t maxQueuedBytes = 64 * 1024 * 1024;
+    // Called on the worker thread for every failed write; must not enqueue writes itself
+    std::function<void(const FileError &)> onError;
+  };
+
+  /**
+   * @brief IFileWriter decorator writing behind the caller's back
+   *
+   * write(), writeBytes() and writeLines() copy their data into a queue and return at once;
+   * only an empty path is reported synchronously. One worker thread applies the queued
+   * writes in order through the wrapped writer. Whatever accumulated while it was busy is
+   * coalesced first: appends to the path written just before are concatenated into that
+   * write, and a truncating write to the same path replaces the one before it. Failures go
+   * to AsyncWriterOptions::onError and to the futures of writeAsync() / writeBytesAsync().
+   * touch(), copyFile(), openAppender() and openMapped() wait for queued writes and run
+   * synchronously.
+   */
+  class AsyncFileWriter final : public IFileWriter {
+  public:
+    /**
+     * @brief Create a write-behind queue in front of a writer
+     *
+     * @param inner Writer applying the queued writes
+     * @param options
+     */
+    explicit AsyncFileWriter(std::shared_ptr<IFileWriter> inner, AsyncWriterOptions options = {});
+
+    /**
+     * @brief Applies all queued writes before returning
+     *
+     */
+    ~AsyncFileWriter() override;
+
+    AsyncFileWriter(const AsyncFileWriter &) = delete;
+    AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+    AsyncFileWriter(AsyncFileWriter &&) = delete;
+    AsyncFileWriter &operator=(AsyncFileWriter &&) = delete;
+
+    [[nodiscard]]
+    Result<void, FileError> write(const std::filesystem::path &filePath, const std::string &content,
+                                  bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                       const std::vector<uint8_t> &data,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                       std::span<const uint8_t> data,
+                                       const WriteOptions &options) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                       const std::vector<std::string> &lines,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                       std::span<const std::string_view> lines,
+                                       bool append = false) const override;
+
+    [[nodiscard]]
+    Result<void, FileError> touch(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<CopyStats, FileError> copyFile(const std::filesystem::path &source,
+                                          const std::filesystem::path &destination,
+                                          const CopyOptions &options = {}) const override;
+
+    [[nodiscard]]
+    Result<std::unique_ptr<IFileAppender>, FileError>
+        openAppender(const std::filesystem::path &filePath,
+                     const AppenderOptions &options = {}) const override;
+
+    [[nodiscard]]
+    Result<MappedOutput, FileError> openMapped(const std::filesystem::path &filePath,
+                                               std::size_t capacity) const override;
+
+    /**
+     * @brief Queue a text write and observe its outcome
+     *
+     * @param filePath
+     * @param content
+     * @param append
+     * @return std::future<Result<void, FileError>> Ready once the write was applied
+     */
+    [[nodiscard]]
+    std::future<Result<void, FileError>>
+        writeAsync(const std::filesystem::path &filePath, std::string content,
+                   bool append = false) const;
+
+    /**
+     * @brief Queue a binary write and observe its outcome
+     *
+     * @param filePath
+     * @param data
+     * @param options
+     * @return std::future<Result<void, FileError>> Ready once the write was applied
+     */
+    [[nodiscard]]
+    std::future<Result<void, FileError>>
+        writeBytesAsync(const std::filesystem::path &filePath, std::vector<uint8_t> data,
+                        const WriteOptions &options = {}) const;
+
+    /**
+     * @brief Block until every write queued before the call has been applied
+     *
+     */
+    void drain() const;
+
+    /**
+     * @brief Bytes queued and not yet applied
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t queuedBytes() const;
+
+  private:
+    enum class Kind : std::uint8_t { Text, Binary };
+
+    struct Operation {
+      Operation(Kind kind, std::filesystem::path path, std::string data, WriteOptions options)
+          : kind(kind), path(std::move(path)), data(std::move(data)), options(options),
+            queuedBytes(this->data.size()) {}
+
+      Kind kind = Kind::Text;
+      std::filesystem::path path;
+      std::string data;
+      WriteOptions options;
+      // One per original write; coalesced operations carry several
+      std::vector<std::promise<Result<void, FileError>>> promises;
+      std::size_t queuedBytes = 0;
+      std::size_t count = 1;
+    };
+
+    std::future<Result<void, FileError>> enqueue(Operation operation, bool observe) const;
+    Result<void, FileError> enqueueDetached(Operation operation) const;
+    [[nodiscard]]
+    Result<void, FileError> apply(const Operation &operation) const;
+    void run();
+
+    static std::vector<Operation> coalesce(std::deque<Operation> &batch);
+
+    std::shared_ptr<IFileWriter> inner_;
+    AsyncWriterOptions options_;
+
+    mutable std::mutex mutex_;
+    mutable std::condition_variable workAvailable_;
+    mutable std::condition_variable progress_; // Writes applied: drain() and backpressure
+    mutable std::deque<Operation> queue_;
+    mutable std::size_t queuedBytes_ = 0;
+    mutable std::uint64_t enqueued_ = 0;
+    mutable std::uint64_t completed_ = 0;
+    bool stopping_ = false;
+    std::thread worker_;
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,82 @@
+#include "BufferPool.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace dotnamecpp::utils {
+
+  BufferPool::Buffer::Buffer(Buffer &&other) noexcept
+      : pool_(std::exchange(other.pool_, nullptr)), storage_(std::move(other.storage_)),
+        size_(std::exchange(other.size_, 0)) {}
+
+  BufferPool::Buffer &BufferPool::Buffer::operator=(Buffer &&other) noexcept {
+    if (this != &other) {
+      release();
+      pool_ = std::exchange(other.pool_, nullptr);
+      storage_ = std::move(other.storage_);
+      size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+  }
+
+  void BufferPool::Buffer::resize(std::size_t size) {
+    if (size > storage_.size()) {
+      throw std::length_error("BufferPool::Buffer cannot grow beyond its capacity");
+    }
+    size_ = size;
+  }
+
+  void BufferPool::Buffer::release() noexcept {
+    if (pool_ != nullptr) {
+      pool_->giveBack(std::move(storage_));
+      pool_ = nullptr;
+    }
+    storage_ = {};
+    size_ = 0;
+  }
+
+  BufferPool::Buffer BufferPool::acquire(std::size_t size) {
+    std::vector<std::byte> storage;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto best = idle_.end();
+      for (auto it = idle_.begin(); it != idle_.end(); ++it) {
+        if (it->size() >= size && (best == idle_.end() || it->size() < best->size())) {
+          best = it;
+        }
+      }
+      if (best != idle_.end()) {
+        storage = std::move(*best);
+        idle_.erase(best);
+      }
+    }
+    if (storage.size() < size) {
+      storage.resize(size);
+    }
+    return Buffer(this, std::move(storage), size);
+  }
+
+  std::size_t BufferPool::idleCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_.size();
+  }
+
+  void BufferPool::giveBack(std::vector<std::byte> storage) {
+    if (storage.empty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_.size() < maxIdleBuffers_) {
+      idle_.push_back(std::move(storage));
+    } else {
+      // Keep the larger buffers, they can serve any smaller request
+      auto smallest = std::min_element(
+          idle_.begin(), idle_.end(),
+          [](const auto &lhs, const auto &rhs) { return lhs.size() < rhs.size(); });
+      if (smallest != idle_.end() && smallest->size() < storage.size()) {
+        *smallest = std::move(storage);
+      }
+    }
+  }
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Thread-safe pool of reusable byte buffers for repeated reads
+   *
+   * Buffers keep their capacity when returned, so reading many similarly sized files
+   * allocates (and zero-fills) only until the pool is warm. The pool must outlive the buffers
+   * acquired from it.
+   */
+  class BufferPool final {
+  public:
+    /**
+     * @brief A buffer leased from the pool, handed back on destruction
+     *
+     */
+    class Buffer final {
+    public:
+      Buffer() = default;
+      ~Buffer() { release(); }
+
+      Buffer(const Buffer &) = delete;
+      Buffer &operator=(const Buffer &) = delete;
+      Buffer(Buffer &&other) noexcept;
+      Buffer &operator=(Buffer &&other) noexcept;
+
+      /**
+       * @brief Writable view of the whole buffer
+       *
+       * @return std::span<std::byte>
+       */
+      [[nodiscard]]
+      std::span<std::byte> span() noexcept {
+        return {storage_.data(), size_};
+      }
+
+      [[nodiscard]]
+      std::span<const std::byte> bytes() const noexcept {
+        return {storage_.data(), size_};
+      }
+
+      [[nodiscard]]
+      std::string_view view() const noexcept {
+        return size_ == 0 ? std::string_view{}
+                          : std::string_view(reinterpret_cast<const char *>(storage_.data()),
+                                             size_);
+      }
+
+      [[nodiscard]]
+      std::size_t size() const noexcept {
+        return size_;
+      }
+
+      [[nodiscard]]
+      std::size_t capacity() const noexcept {
+        return storage_.size();
+      }
+
+      /**
+       * @brief Change the logical size, never beyond capacity(); contents are kept
+       *
+       * @param size
+       */
+      void resize(std::size_t size);
+
+    private:
+      friend class BufferPool;
+      Buffer(BufferPool *pool, std::vector<std::byte> storage, std::size_t size)
+          : pool_(pool), storage_(std::move(storage)), size_(size) {}
+
+      void release() noexcept;
+
+      BufferPool *pool_ = nullptr;
+      std::vector<std::byte> storage_; // Always sized to its full capacity
+      std::size_t size_ = 0;
+    };
+
+    /**
+     * @brief Create a pool
+     *
+     * @param maxIdleBuffers Buffers kept for reuse; further returned buffers are freed
+     */
+    explicit BufferPool(std::size_t maxIdleBuffers = 16) : maxIdleBuffers_(maxIdleBuffers) {
+      idle_.reserve(maxIdleBuffers_); // Returning a buffer never allocates
+    }
+
+    BufferPool(const BufferPool &) = delete;
+    BufferPool &operator=(const BufferPool &) = delete;
+    BufferPool(BufferPool &&) = delete;
+    BufferPool &operator=(BufferPool &&) = delete;
+    ~BufferPool() = default;
+
+    /**
+     * @brief Lease a buffer of at least size bytes, reusing the smallest idle one that fits
+     *
+     * @param size
+     * @return Buffer with size() == size
+     */
+    [[nodiscard]]
+    Buffer acquire(std::size_t size);
+
+    /**
+     * @brief Number of idle buffers ready for reuse
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t idleCount() const;
+
+  private:
+    void giveBack(std::vector<std::byte> storage);
+
+    mutable std::mutex mutex_;
+    std::vector<std::vector<std::byte>> idle_;
+    std::size_t maxIdleBuffers_;
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,344 @@
+#include "CachingFileReader.hpp"
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace dotnamecpp::utils {
+
+  CachingFileReader::CachingFileReader(std::shared_ptr<IFileReader> inner, FileCacheConfig config,
+                                       std::shared_ptr<FileWatcher> watcher)
+      : inner_(std::move(inner)), shardCount_(std::max<std::size_t>(config.shardCount, 1)),
+        watcher_(std::move(watcher)) {
+    if (!inner_) {
+      throw std::invalid_argument("CachingFileReader requires a file reader");
+    }
+    shardBudget_ = config.maxBytes / shardCount_;
+    const std::size_t maxEntrySize =
+        config.maxEntrySize == 0 ? config.maxBytes / 8 : config.maxEntrySize;
+    // An entry larger than its shard would evict everything else and itself
+    maxEntrySize_ = std::min(maxEntrySize, shardBudget_);
+    shards_ = std::make_unique<Shard[]>(shardCount_);
+    if (watcher_) {
+      listenerId_ =
+          watcher_->addListener([this](const std::filesystem::path &path) { invalidate(path); });
+    }
+  }
+
+  CachingFileReader::~CachingFileReader() {
+    if (watcher_) {
+      watcher_->removeListener(listenerId_);
+      clear(); // Releases the watches held by the entries
+    }
+  }
+
+  // ==========================================================================
+  // Cached operations
+  // ==========================================================================
+
+  Result<std::string, FileError>
+      CachingFileReader::read(const std::filesystem::path &filePath) const {
+    auto cached = content(filePath);
+    if (!cached) {
+      return cached.error();
+    }
+    return *cached.value();
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CachingFileReader::readBytes(const std::filesystem::path &filePath) const {
+    auto cached = content(filePath);
+    if (!cached) {
+      return cached.error();
+    }
+    const std::string &data = *cached.value();
+    return std::vector<uint8_t>(data.begin(), data.end());
+  }
+
+  Result<std::size_t, FileError> CachingFileReader::readInto(const std::filesystem::path &filePath,
+                                                             std::span<std::byte> buffer) const {
+    auto cached = content(filePath);
+    if (!cached) {
+      return cached.error();
+    }
+    const std::string &data = *cached.value();
+    if (data.size() > buffer.size()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "File does not fit into the buffer",
+          .path = filePath.string(),
+      };
+    }
+    if (!data.empty()) {
+      std::memcpy(buffer.data(), data.data(), data.size());
+    }
+    return data.size();
+  }
+
+  Result<std::size_t, FileError> CachingFileReader::readInto(const std::filesystem::path &filePath,
+                                                             std::pmr::string &buffer) const {
+    auto cached = content(filePath);
+    if (!cached) {
+      return cached.error();
+    }
+    buffer.assign(*cached.value());
+    return buffer.size();
+  }
+
+  Result<ChecksummedContent, FileError>
+      CachingFileReader::readWithChecksum(const std::filesystem::path &filePath,
+                                          ChecksumAlgorithm algorithm) const {
+    auto cached = content(filePath);
+    if (!cached) {
+      return cached.error();
+    }
+    Checksum checksum(algorithm);
+    checksum.update(*cached.value());
+    return ChecksummedContent{.content = *cached.value(), .checksum = checksum.digest()};
+  }
+
+  // ==========================================================================
+  // Forwarded operations
+  // ==========================================================================
+
+  Result<BufferPool::Buffer, FileError>
+      CachingFileReader::readPooled(const std::filesystem::path &filePath,
+                                    BufferPool &pool) const {
+    return inner_->readPooled(filePath, pool);
+  }
+
+  Result<MappedFile, FileError>
+      CachingFileReader::readMapped(const std::filesystem::path &filePath,
+                                    const ReadHints &hints) const {
+    return inner_->readMapped(filePath, hints);
+  }
+
+  Result<LineView, FileError>
+      CachingFileReader::readLineView(const std::filesystem::path &filePath) const {
+    return inner_->readLineView(filePath);
+  }
+
+  Result<std::size_t, FileError>
+      CachingFileReader::forEachLine(const std::filesystem::path &filePath,
+                                     const LineCallback &callback, std::size_t chunkSize) const {
+    return inner_->forEachLine(filePath, callback, chunkSize);
+  }
+
+  Result<std::uintmax_t, FileError>
+      CachingFileReader::readChunks(const std::filesystem::path &filePath,
+                                    const ChunkCallback &callback,
+                                    const ReadChunkOptions &options) const {
+    return inner_->readChunks(filePath, callback, options);
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      CachingFileReader::readParallel(const std::filesystem::path &filePath,
+                                      const ParallelReadOptions &options) const {
+    return inner_->readParallel(filePath, options);
+  }
+
+  Result<std::uintmax_t, FileError>
+      CachingFileReader::readRangesParallel(const std::filesystem::path &filePath,
+                                            const RangeCallback &callback,
+                                            const ParallelReadOptions &options) const {
+    return inner_->readRangesParallel(filePath, callback, options);
+  }
+
+  std::vector<std::future<Result<std::string, FileError>>>
+      CachingFileReader::readAsync(const std::vector<std::filesystem::path> &filePaths,
+                                   IoThreadPool *pool) const {
+    return inner_->readAsync(filePaths, pool);
+  }
+
+  std::future<void>
+      CachingFileReader::readAsync(const std::vector<std::filesystem::path> &filePaths,
+                                   ReadCompletion onComplete, IoThreadPool *pool) const {
+    return inner_->readAsync(filePaths, std::move(onComplete), pool);
+  }
+
+  Result<std::uint64_t, FileError>
+      CachingFileReader::hashFile(const std::filesystem::path &filePath,
+                                  ChecksumAlgorithm algorithm,
+                                  const ReadChunkOptions &options) const {
+    return inner_->hashFile(filePath, algorithm, options);
+  }
+
+  std::future<void> CachingFileReader::prefetch(const std::vector<std::filesystem::path> &filePaths,
+                                                IoThreadPool *pool) const {
+    return inner_->prefetch(filePaths, pool);
+  }
+
+  Result<std::vector<std::string>, FileError>
+      CachingFileReader::readLines(const std::filesystem::path &filePath) const {
+    return inner_->readLines(filePath);
+  }
+
+  bool CachingFileReader::exists(const std::filesystem::path &filePath) const {
+    return inner_->exists(filePath);
+  }
+
+  Result<std::uintmax_t, FileError>
+      CachingFileReader::getSize(const std::filesystem::path &filePath) const {
+    return inner_->getSize(filePath);
+  }
+
+  // ==========================================================================
+  // Cache management
+  // ==========================================================================
+
+  void CachingFileReader::invalidate(const std::filesystem::path &filePath) const {
+    const std::string key = makeKey(filePath);
+    Shard &shard = shardFor(key);
+    // Bumped before locking, so a concurrent load of this file cannot insert a watched entry
+    // that misses this invalidation (see insert())
+    invalidationEpoch_.fetch_add(1);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (auto it = shard.index.find(key); it != shard.index.end()) {
+      erase(shard, it->second);
+      invalidations_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void CachingFileReader::clear() const {
+    for (std::size_t i = 0; i < shardCount_; ++i) {
+      Shard &shard = shards_[i];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      while (!shard.lru.empty()) {
+        erase(shard, shard.lru.begin());
+      }
+    }
+  }
+
+  FileCacheStats CachingFileReader::stats() const {
+    FileCacheStats result{
+        .hits = hits_.load(std::memory_order_relaxed),
+        .misses = misses_.load(std::memory_order_relaxed),
+        .evictions = evictions_.load(std::memory_order_relaxed),
+        .invalidations = invalidations_.load(std::memory_order_relaxed),
+    };
+    for (std::size_t i = 0; i < shardCount_; ++i) {
+      Shard &shard = shards_[i];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      result.entries += shard.lru.size();
+      result.bytes += shard.bytes;
+    }
+    return result;
+  }
+
+  std::string CachingFileReader::makeKey(const std::filesystem::path &filePath) {
+    // Aliases of one file only cost memory, the stamp check keeps them correct
+    return FileWatcher::normalize(filePath).string();
+  }
+
+  CachingFileReader::Shard &CachingFileReader::shardFor(const std::string &key) const {
+    return shards_[std::hash<std::string>{}(key) % shardCount_];
+  }
+
+  Result<std::shared_ptr<const std::string>, FileError>
+      CachingFileReader::content(const std::filesystem::path &filePath) const {
+    std::string key = makeKey(filePath);
+    Shard &shard = shardFor(key);
+    if (watcher_) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (auto it = shard.index.find(key); it != shard.index.end() && it->second->watched) {
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        hits_.fetch_add(1, std::memory_order_relaxed);
+        return it->second->content;
+      }
+    }
+
+    // Watch before taking the stamp: a change after this point is reported by the watcher
+    const std::uint64_t epoch = invalidationEpoch_.load();
+    bool watched = watcher_ && watcher_->watch(key);
+
+    // The stamp is taken before reading: if the file changes in between, the entry carries
+    // the older stamp and is reloaded on the next access
+    const auto stamp = statFileStamp(filePath);
+    if (!stamp) {
+      if (watched) {
+        watcher_->unwatch(key);
+      }
+      // Missing, a directory or not a regular file: let the wrapped reader report it
+      misses_.fetch_add(1, std::memory_order_relaxed);
+      auto result = inner_->read(filePath);
+      if (!result) {
+        return result.error();
+      }
+      return std::make_shared<const std::string>(std::move(result).value());
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (auto it = shard.index.find(key); it != shard.index.end()) {
+        if (it->second->stamp == *stamp) {
+          if (watched && !it->second->watched) {
+            it->second->watched = true; // Validated after the watch started
+            watched = false;
+          }
+          shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+          hits_.fetch_add(1, std::memory_order_relaxed);
+          auto content = it->second->content;
+          if (watched) {
+            watcher_->unwatch(key);
+          }
+          return content;
+        }
+        erase(shard, it->second);
+        invalidations_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    auto result = inner_->read(filePath);
+    if (!result) {
+      if (watched) {
+        watcher_->unwatch(key);
+      }
+      return result.error();
+    }
+    auto data = std::make_shared<const std::string>(std::move(result).value());
+    if (data->size() <= maxEntrySize_ && data->size() == stamp->size) {
+      insert(shard, std::move(key), *stamp, data, watched, epoch);
+    } else if (watched) {
+      watcher_->unwatch(key);
+    }
+    return data;
+  }
+
+  void CachingFileReader::insert(Shard &shard, std::string key, FileStamp stamp,
+                                 std::shared_ptr<const std::string> content, bool watched,
+                                 std::uint64_t epoch) const {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (watched && invalidationEpoch_.load() != epoch) {
+      // An invalidation raced with the load and may have concerned this file: keep the entry,
+      // but validate it by stamp
+      watcher_->unwatch(key);
+      watched = false;
+    }
+    if (auto it = shard.index.find(key); it != shard.index.end()) {
+      erase(shard, it->second); // Loaded concurrently by another thread
+    }
+
+    shard.bytes += content->size();
+    shard.lru.push_front(
+        Entry{.key = key, .stamp = stamp, .content = std::move(content), .watched = watched});
+    shard.index.emplace(std::move(key), shard.lru.begin());
+
+    while (shard.bytes > shardBudget_ && shard.lru.size() > 1) {
+      erase(shard, std::prev(shard.lru.end()));
+      evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void CachingFileReader::erase(Shard &shard, std::list<Entry>::iterator entry) const {
+    if (entry->watched) {
+      watcher_->unwatch(entry->key);
+    }
+    shard.bytes -= entry->content->size();
+    shard.index.erase(entry->key);
+    shard.lru.erase(entry);
+  }
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <Utils/Filesystem/FileWatcher.hpp>
+#include <Utils/Filesystem/IFileReader.hpp>
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Configuration of CachingFileReader
+   *
+   */
+  struct FileCacheConfig {
+    std::size_t maxBytes = 64 * 1024 * 1024; // Budget for cached content across all shards
+    std::size_t shardCount = 16;             // Independently locked LRU shards
+    std::size_t maxEntrySize = 0;            // Larger files bypass the cache, 0 = maxBytes / 8
+  };
+
+  /**
+   * @brief Counters of a CachingFileReader
+   *
+   */
+  struct FileCacheStats {
+    std::uint64_t hits = 0;
+    std::uint64_t misses = 0;
+    std::uint64_t evictions = 0;     // Entries dropped to stay within the byte budget
+    std::uint64_t invalidations = 0; // Entries dropped because the file changed
+    std::size_t entries = 0;
+    std::size_t bytes = 0;
+  };
+
+  /**
+   * @brief IFileReader decorator keeping file contents in memory
+   *
+   * Contents are held in a sharded LRU under a global byte budget, keyed by the absolute,
+   * lexically normalized path. An entry is used only while the file's identity and version
+   * (device, inode, size, modification time in ns) are unchanged, which costs one stat() per
+   * hit. With a FileWatcher, cached files are watched instead and a hit is a pure memory
+   * lookup; a change then becomes visible once the watcher has reported it. With inotify that
+   * takes milliseconds, but a polling watcher (no inotify, or forcePolling) can serve stale
+   * content for up to FileWatcherOptions::pollInterval after a change. read(),
+   * readBytes(), both readInto() overloads and readWithChecksum() are served from the cache;
+   * every other operation is forwarded to the wrapped reader.
+   */
+  class CachingFileReader final : public IFileReader {
+  public:
+    /**
+     * @brief Create a cache in front of a reader
+     *
+     * @param inner Reader used on a miss and for all uncached operations
+     * @param config
+     * @param watcher Optional watcher replacing the per-hit stat() with change notifications
+     */
+    explicit CachingFileReader(std::shared_ptr<IFileReader> inner, FileCacheConfig config = {},
+                               std::shared_ptr<FileWatcher> watcher = nullptr);
+    ~CachingFileReader() override;
+
+    CachingFileReader(const CachingFileReader &) = delete;
+    CachingFileReader &operator=(const CachingFileReader &) = delete;
+    CachingFileReader(CachingFileReader &&) = delete;
+    CachingFileReader &operator=(CachingFileReader &&) = delete;
+
+    [[nodiscard]]
+    Result<std::string, FileError> read(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readBytes(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::span<std::byte> buffer) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::pmr::string &buffer) const override;
+
+    [[nodiscard]]
+    Result<BufferPool::Buffer, FileError> readPooled(const std::filesystem::path &filePath,
+                                                     BufferPool &pool) const override;
+
+    [[nodiscard]]
+    Result<MappedFile, FileError> readMapped(const std::filesystem::path &filePath,
+                                             const ReadHints &hints = {}) const override;
+
+    [[nodiscard]]
+    Result<LineView, FileError>
+        readLineView(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> forEachLine(const std::filesystem::path &filePath,
+                                               const LineCallback &callback,
+                                               std::size_t chunkSize = kDefaultChunkSize)
+        const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> readChunks(const std::filesystem::path &filePath,
+                                                 const ChunkCallback &callback,
+                                                 const ReadChunkOptions &options = {})
+        const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readParallel(const std::filesystem::path &filePath,
+                     const ParallelReadOptions &options = {}) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError>
+        readRangesParallel(const std::filesystem::path &filePath, const RangeCallback &callback,
+                           const ParallelReadOptions &options = {}) const override;
+
+    [[nodiscard]]
+    std::vector<std::future<Result<std::string, FileError>>>
+        readAsync(const std::vector<std::filesystem::path> &filePaths,
+                  IoThreadPool *pool = nullptr) const override;
+
+    std::future<void> readAsync(const std::vector<std::filesystem::path> &filePaths,
+                                ReadCompletion onComplete,
+                                IoThreadPool *pool = nullptr) const override;
+
+    [[nodiscard]]
+    Result<ChecksummedContent, FileError>
+        readWithChecksum(const std::filesystem::path &filePath,
+                         ChecksumAlgorithm algorithm) const override;
+
+    [[nodiscard]]
+    Result<std::uint64_t, FileError> hashFile(const std::filesystem::path &filePath,
+                                              ChecksumAlgorithm algorithm,
+                                              const ReadChunkOptions &options = {}) const override;
+
+    std::future<void> prefetch(const std::vector<std::filesystem::path> &filePaths,
+                               IoThreadPool *pool = nullptr) const override;
+
+    [[nodiscard]]
+    Result<std::vector<std::string>, FileError>
+        readLines(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    bool exists(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> getSize(const std::filesystem::path &filePath) const override;
+
+    /**
+     * @brief Drop the cached content of one file
+     *
+     * @param filePath
+     */
+    void invalidate(const std::filesystem::path &filePath) const;
+
+    /**
+     * @brief Drop all cached content
+     *
+     */
+    void clear() const;
+
+    /**
+     * @brief Snapshot of the cache counters
+     *
+     * @return FileCacheStats
+     */
+    [[nodiscard]]
+    FileCacheStats stats() const;
+
+  private:
+    struct Entry {
+      std::string key;
+      FileStamp stamp;
+      std::shared_ptr<const std::string> content;
+      bool watched = false; // Holds a watch, so the stamp is not checked on a hit
+    };
+
+    struct Shard {
+      std::mutex mutex;
+      std::list<Entry> lru; // Most recently used first
+      std::unordered_map<std::string, std::list<Entry>::iterator> index;
+      std::size_t bytes = 0;
+    };
+
+    [[nodiscard]]
+    static std::string makeKey(const std::filesystem::path &filePath);
+
+    [[nodiscard]]
+    Shard &shardFor(const std::string &key) const;
+
+    /**
+     * @brief Get the content of a file from the cache, loading it on a miss
+     *
+     */
+    [[nodiscard]]
+    Result<std::shared_ptr<const std::string>, FileError>
+        content(const std::filesystem::path &filePath) const;
+
+    void insert(Shard &shard, std::string key, FileStamp stamp,
+                std::shared_ptr<const std::string> content, bool watched,
+                std::uint64_t epoch) const;
+
+    /**
+     * @brief Remove an entry, releasing its watch; the shard must be locked
+     *
+     */
+    void erase(Shard &shard, std::list<Entry>::iterator entry) const;
+
+    std::shared_ptr<IFileReader> inner_;
+    std::size_t shardBudget_;
+    std::size_t maxEntrySize_;
+    std::unique_ptr<Shard[]> shards_;
+    std::size_t shardCount_;
+    std::shared_ptr<FileWatcher> watcher_;
+    FileWatcher::ListenerId listenerId_ = 0;
+
+    mutable std::atomic<std::uint64_t> hits_{0};
+    mutable std::atomic<std::uint64_t> misses_{0};
+    mutable std::atomic<std::uint64_t> evictions_{0};
+    mutable std::atomic<std::uint64_t> invalidations_{0};
+    mutable std::atomic<std::uint64_t> invalidationEpoch_{0}; // Bumped by every invalidate()
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,314 @@
+#include "Checksum.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define DOTNAME_CRC32C_SSE42 1
+#include <nmmintrin.h>
+#elif defined(_M_X64) && defined(_MSC_VER)
+#define DOTNAME_CRC32C_SSE42 1
+#include <intrin.h>
+#include <nmmintrin.h>
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define DOTNAME_CRC32C_ARMV8 1
+#include <arm_acle.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#endif
+
+namespace dotnamecpp::utils {
+
+  namespace {
+
+    // --------------------------------------------------------------------------
+    // Little-endian loads
+    // --------------------------------------------------------------------------
+
+    constexpr std::uint64_t byteSwap64(std::uint64_t value) noexcept {
+      std::uint64_t swapped = 0;
+      for (int i = 0; i < 8; ++i, value >>= 8) {
+        swapped = (swapped << 8) | (value & 0xFF);
+      }
+      return swapped;
+    }
+
+    std::uint64_t load64(const unsigned char *data) noexcept {
+      std::uint64_t value = 0;
+      std::memcpy(&value, data, sizeof(value));
+      if constexpr (std::endian::native == std::endian::big) {
+        value = byteSwap64(value);
+      }
+      return value;
+    }
+
+    std::uint32_t load32(const unsigned char *data) noexcept {
+      std::uint32_t value = 0;
+      std::memcpy(&value, data, sizeof(value));
+      if constexpr (std::endian::native == std::endian::big) {
+        value = static_cast<std::uint32_t>(byteSwap64(value) >> 32);
+      }
+      return value;
+    }
+
+    // --------------------------------------------------------------------------
+    // CRC-32C
+    // --------------------------------------------------------------------------
+
+    constexpr std::uint32_t kCrc32cPolynomial = 0x82F63B78; // Reflected Castagnoli
+
+    using Crc32cTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+    constexpr Crc32cTables makeCrc32cTables() {
+      Crc32cTables tables{};
+      for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; ++bit) {
+          crc = (crc >> 1) ^ (kCrc32cPolynomial & (0U - (crc & 1U)));
+        }
+        tables[0][i] = crc;
+      }
+      for (std::size_t k = 1; k < tables.size(); ++k) {
+        for (std::size_t i = 0; i < 256; ++i) {
+          tables[k][i] = (tables[k - 1][i] >> 8) ^ tables[0][tables[k - 1][i] & 0xFF];
+        }
+      }
+      return tables;
+    }
+
+    constexpr Crc32cTables kCrc32cTables = makeCrc32cTables();
+
+    // All implementations take and return the CRC register, i.e. without the final inversion
+    using Crc32cFunction = std::uint32_t (*)(std::uint32_t, const unsigned char *, std::size_t);
+
+    // Slicing-by-8: eight table lookups per 64-bit word
+    std::uint32_t crc32cSoftware(std::uint32_t crc, const unsigned char *data,
+                                 std::size_t size) noexcept {
+      const auto &t = kCrc32cTables;
+      for (; size >= 8; data += 8, size -= 8) {
+        const std::uint64_t word = load64(data) ^ crc;
+        crc = t[7][word & 0xFF] ^ t[6][(word >> 8) & 0xFF] ^ t[5][(word >> 16) & 0xFF] ^
+              t[4][(word >> 24) & 0xFF] ^ t[3][(word >> 32) & 0xFF] ^ t[2][(word >> 40) & 0xFF] ^
+              t[1][(word >> 48) & 0xFF] ^ t[0][word >> 56];
+      }
+      for (; size > 0; ++data, --size) {
+        crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+      }
+      return crc;
+    }
+
+#if defined(DOTNAME_CRC32C_SSE42)
+#if !defined(_MSC_VER)
+    __attribute__((target("sse4.2")))
+#endif
+    std::uint32_t
+        crc32cSse42(std::uint32_t crc, const unsigned char *data, std::size_t size) noexcept {
+      std::uint64_t crc64 = crc;
+      for (; size >= 8; data += 8, size -= 8) {
+        crc64 = _mm_crc32_u64(crc64, load64(data));
+      }
+      auto crc32 = static_cast<std::uint32_t>(crc64);
+      for (; size > 0; ++data, --size) {
+        crc32 = _mm_crc32_u8(crc32, *data);
+      }
+      return crc32;
+    }
+
+    bool cpuHasCrc32c() noexcept {
+#if defined(_MSC_VER)
+      int info[4] = {};
+      __cpuid(info, 1);
+      return (info[2] & (1 << 20)) != 0; // ECX.SSE4_2
+#else
+      return __builtin_cpu_supports("sse4.2") != 0;
+#endif
+    }
+
+    constexpr Crc32cFunction kHardwareCrc32c = crc32cSse42;
+#elif defined(DOTNAME_CRC32C_ARMV8)
+#if defined(__clang__)
+    __attribute__((target("crc")))
+#else
+    __attribute__((target("+crc")))
+#endif
+    std::uint32_t
+        crc32cArmv8(std::uint32_t crc, const unsigned char *data, std::size_t size) noexcept {
+      for (; size >= 8; data += 8, size -= 8) {
+        crc = __crc32cd(crc, load64(data));
+      }
+      for (; size > 0; ++data, --size) {
+        crc = __crc32cb(crc, *data);
+      }
+      return crc;
+    }
+
+    bool cpuHasCrc32c() noexcept {
+#if defined(__ARM_FEATURE_CRC32) || defined(__APPLE__)
+      return true;
+#elif defined(__linux__) && defined(HWCAP_CRC32)
+      return (::getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#else
+      return false;
+#endif
+    }
+
+    constexpr Crc32cFunction kHardwareCrc32c = crc32cArmv8;
+#endif
+
+    Crc32cFunction crc32cImplementation() noexcept {
+#if defined(DOTNAME_CRC32C_SSE42) || defined(DOTNAME_CRC32C_ARMV8)
+      static const Crc32cFunction implementation =
+          cpuHasCrc32c() ? kHardwareCrc32c : crc32cSoftware;
+      return implementation;
+#else
+      return crc32cSoftware;
+#endif
+    }
+
+    std::uint32_t crc32cUpdate(std::uint32_t previous, std::span<const std::byte> data) noexcept {
+      const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+      return ~crc32cImplementation()(~previous, bytes, data.size());
+    }
+
+    // --------------------------------------------------------------------------
+    // XXH64
+    // --------------------------------------------------------------------------
+
+    constexpr std::uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+    constexpr std::uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr std::uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+    constexpr std::size_t kStripeSize = 32;
+
+    using Lanes = std::array<std::uint64_t, 4>;
+
+    std::uint64_t xxhRound(std::uint64_t acc, std::uint64_t input) noexcept {
+      acc += input * kPrime2;
+      return std::rotl(acc, 31) * kPrime1;
+    }
+
+    std::uint64_t xxhMergeRound(std::uint64_t acc, std::uint64_t lane) noexcept {
+      acc ^= xxhRound(0, lane);
+      return acc * kPrime1 + kPrime4;
+    }
+
+    Lanes xxhInit(std::uint64_t seed) noexcept {
+      return {seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1};
+    }
+
+    // Consume whole stripes, returning the number of bytes used
+    std::size_t xxhStripes(Lanes &lanes, const unsigned char *data, std::size_t size) noexcept {
+      std::size_t used = 0;
+      for (; size - used >= kStripeSize; used += kStripeSize) {
+        for (std::size_t lane = 0; lane < lanes.size(); ++lane) {
+          lanes[lane] = xxhRound(lanes[lane], load64(data + used + lane * 8));
+        }
+      }
+      return used;
+    }
+
+    std::uint64_t xxhFinish(const Lanes &lanes, std::uint64_t totalSize,
+                            const unsigned char *tail, std::size_t tailSize) noexcept {
+      std::uint64_t hash = 0;
+      if (totalSize >= kStripeSize) {
+        hash = std::rotl(lanes[0], 1) + std::rotl(lanes[1], 7) + std::rotl(lanes[2], 12) +
+               std::rotl(lanes[3], 18);
+        for (const std::uint64_t lane : lanes) {
+          hash = xxhMergeRound(hash, lane);
+        }
+      } else {
+        hash = lanes[2] + kPrime5; // lanes[2] still holds the seed
+      }
+      hash += totalSize;
+
+      for (; tailSize >= 8; tail += 8, tailSize -= 8) {
+        hash ^= xxhRound(0, load64(tail));
+        hash = std::rotl(hash, 27) * kPrime1 + kPrime4;
+      }
+      if (tailSize >= 4) {
+        hash ^= static_cast<std::uint64_t>(load32(tail)) * kPrime1;
+        hash = std::rotl(hash, 23) * kPrime2 + kPrime3;
+        tail += 4;
+        tailSize -= 4;
+      }
+      for (; tailSize > 0; ++tail, --tailSize) {
+        hash ^= *tail * kPrime5;
+        hash = std::rotl(hash, 11) * kPrime1;
+      }
+
+      hash ^= hash >> 33;
+      hash *= kPrime2;
+      hash ^= hash >> 29;
+      hash *= kPrime3;
+      hash ^= hash >> 32;
+      return hash;
+    }
+
+  } // namespace
+
+  Checksum::Checksum(ChecksumAlgorithm algorithm) noexcept
+      : algorithm_(algorithm), lanes_(xxhInit(0)) {}
+
+  void Checksum::update(std::span<const std::byte> data) noexcept {
+    if (algorithm_ == ChecksumAlgorithm::Crc32c) {
+      crc_ = crc32cUpdate(crc_, data);
+      return;
+    }
+
+    const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+    std::size_t size = data.size();
+    totalSize_ += size;
+
+    // Complete a stripe left over from the previous call first
+    if (pendingSize_ > 0) {
+      const std::size_t fill = std::min(size, kStripeSize - pendingSize_);
+      std::memcpy(pending_.data() + pendingSize_, bytes, fill);
+      pendingSize_ += fill;
+      bytes += fill;
+      size -= fill;
+      if (pendingSize_ < kStripeSize) {
+        return;
+      }
+      xxhStripes(lanes_, reinterpret_cast<const unsigned char *>(pending_.data()), kStripeSize);
+      pendingSize_ = 0;
+    }
+
+    const std::size_t used = xxhStripes(lanes_, bytes, size);
+    pendingSize_ = size - used;
+    if (pendingSize_ > 0) {
+      std::memcpy(pending_.data(), bytes + used, pendingSize_);
+    }
+  }
+
+  std::uint64_t Checksum::digest() const noexcept {
+    if (algorithm_ == ChecksumAlgorithm::Crc32c) {
+      return crc_;
+    }
+    return xxhFinish(lanes_, totalSize_, reinterpret_cast<const unsigned char *>(pending_.data()),
+                     pendingSize_);
+  }
+
+  std::uint32_t Checksum::crc32c(std::span<const std::byte> data, std::uint32_t previous) noexcept {
+    return crc32cUpdate(previous, data);
+  }
+
+  std::uint32_t Checksum::crc32cTable(std::span<const std::byte> data,
+                                      std::uint32_t previous) noexcept {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+    return ~crc32cSoftware(~previous, bytes, data.size());
+  }
+
+  std::uint64_t Checksum::xxHash64(std::span<const std::byte> data, std::uint64_t seed) noexcept {
+    const auto *bytes = reinterpret_cast<const unsigned char *>(data.data());
+    Lanes lanes = xxhInit(seed);
+    const std::size_t used = xxhStripes(lanes, bytes, data.size());
+    return xxhFinish(lanes, data.size(), bytes + used, data.size() - used);
+  }
+
+  bool Checksum::hasHardwareCrc32c() noexcept {
+    return crc32cImplementation() != crc32cSoftware;
+  }
+
+} // namespace dotnamecpp::utils
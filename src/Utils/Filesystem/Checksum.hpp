@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Digest computed by Checksum
+   *
+   */
+  enum class ChecksumAlgorithm : std::uint8_t {
+    Crc32c,   // CRC-32C (Castagnoli), SSE4.2 / ARMv8 CRC instructions when available
+    XxHash64, // 64-bit xxHash, seed 0
+  };
+
+  /**
+   * @brief Incremental CRC-32C or XXH64 digest
+   *
+   * Data can be fed in pieces of any size; the digest equals the one-shot digest of the
+   * concatenated pieces. CRC-32C uses the CPU's CRC instructions when the running CPU has
+   * them (detected once at runtime) and a slicing-by-8 table otherwise.
+   */
+  class Checksum final {
+  public:
+    explicit Checksum(ChecksumAlgorithm algorithm) noexcept;
+
+    /**
+     * @brief Add the next piece of data
+     *
+     * @param data
+     */
+    void update(std::span<const std::byte> data) noexcept;
+
+    void update(std::string_view data) noexcept {
+      update(std::as_bytes(std::span<const char>(data.data(), data.size())));
+    }
+
+    /**
+     * @brief Digest of all data so far; CRC-32C occupies the low 32 bits
+     *
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    std::uint64_t digest() const noexcept;
+
+    [[nodiscard]]
+    ChecksumAlgorithm algorithm() const noexcept {
+      return algorithm_;
+    }
+
+    /**
+     * @brief One-shot CRC-32C, continuing from a previous result
+     *
+     * @param data
+     * @param previous crc32c() of the preceding data, 0 to start
+     * @return std::uint32_t
+     */
+    [[nodiscard]]
+    static std::uint32_t crc32c(std::span<const std::byte> data,
+                                std::uint32_t previous = 0) noexcept;
+
+    /**
+     * @brief One-shot CRC-32C on the slicing-by-8 table, whatever the CPU supports
+     *
+     * Gives the result crc32c() has on CPUs without CRC instructions, so both paths can be
+     * checked against each other on any machine.
+     *
+     * @param data
+     * @param previous crc32cTable() of the preceding data, 0 to start
+     * @return std::uint32_t
+     */
+    [[nodiscard]]
+    static std::uint32_t crc32cTable(std::span<const std::byte> data,
+                                     std::uint32_t previous = 0) noexcept;
+
+    /**
+     * @brief One-shot XXH64
+     *
+     * @param data
+     * @param seed
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    static std::uint64_t xxHash64(std::span<const std::byte> data, std::uint64_t seed = 0) noexcept;
+
+    /**
+     * @brief Whether CRC-32C runs on CPU instructions rather than on the table fallback
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    static bool hasHardwareCrc32c() noexcept;
+
+  private:
+    ChecksumAlgorithm algorithm_;
+    std::uint32_t crc_ = 0;
+
+    // XXH64 streaming state: four lanes over 32-byte stripes, plus an unfinished stripe
+    std::array<std::uint64_t, 4> lanes_{};
+    std::array<std::byte, 32> pending_{};
+    std::size_t pendingSize_ = 0;
+    std::uint64_t totalSize_ = 0;
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,68 @@
+#include "DirectoryCache.hpp"
+#include <system_error>
+
+namespace dotnamecpp::utils {
+
+  DirectoryCache &DirectoryCache::shared() {
+    static DirectoryCache cache;
+    return cache;
+  }
+
+  bool DirectoryCache::contains(const std::filesystem::path &dirPath) const {
+    const auto key = makeKey(dirPath);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return directories_.contains(key);
+  }
+
+  void DirectoryCache::insert(const std::filesystem::path &dirPath) {
+    auto key = makeKey(dirPath);
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      if (directories_.contains(key)) {
+        return;
+      }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    directories_.insert(std::move(key));
+  }
+
+  void DirectoryCache::invalidate(const std::filesystem::path &dirPath) {
+    const auto key = makeKey(dirPath);
+    if (key.empty()) {
+      return;
+    }
+    const auto separator = std::filesystem::path::preferred_separator;
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    std::erase_if(directories_, [&key, separator](const std::string &directory) {
+      return directory.starts_with(key) &&
+             (directory.size() == key.size() || directory[key.size()] == separator ||
+              key.back() == separator);
+    });
+  }
+
+  void DirectoryCache::clear() {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    directories_.clear();
+  }
+
+  std::size_t DirectoryCache::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return directories_.size();
+  }
+
+  std::string DirectoryCache::makeKey(const std::filesystem::path &dirPath) {
+    // absolute() asks for the current directory, so absolute paths skip it
+    std::filesystem::path normalized = dirPath;
+    if (normalized.is_relative()) {
+      std::error_code ec;
+      normalized = std::filesystem::absolute(dirPath, ec);
+    }
+    auto key = normalized.lexically_normal().string();
+    // "a/b/" and "a/b" name the same directory; keep the root's separator
+    while (key.size() > 1 && key.back() == std::filesystem::path::preferred_separator) {
+      key.pop_back();
+    }
+    return key;
+  }
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <filesystem>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_set>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Concurrent set of directories known to exist
+   *
+   * Lets writers skip the stat() of a parent directory they have already seen or created.
+   * Entries are keyed by the lexically normalized path, relative paths being resolved
+   * against the current directory. DirectoryManager invalidates removed directories; a
+   * directory removed behind the process's back makes the next write fail with ENOENT,
+   * after which the writer invalidates the entry and recreates the directory.
+   */
+  class DirectoryCache final {
+  public:
+    DirectoryCache() = default;
+    ~DirectoryCache() = default;
+
+    DirectoryCache(const DirectoryCache &) = delete;
+    DirectoryCache &operator=(const DirectoryCache &) = delete;
+    DirectoryCache(DirectoryCache &&) = delete;
+    DirectoryCache &operator=(DirectoryCache &&) = delete;
+
+    /**
+     * @brief Process-wide instance shared by FileWriter and DirectoryManager
+     *
+     * @return DirectoryCache&
+     */
+    static DirectoryCache &shared();
+
+    [[nodiscard]]
+    bool contains(const std::filesystem::path &dirPath) const;
+
+    void insert(const std::filesystem::path &dirPath);
+
+    /**
+     * @brief Forget a directory together with everything cached below it
+     *
+     * @param dirPath
+     */
+    void invalidate(const std::filesystem::path &dirPath);
+
+    void clear();
+
+    [[nodiscard]]
+    std::size_t size() const;
+
+  private:
+    [[nodiscard]]
+    static std::string makeKey(const std::filesystem::path &dirPath);
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_set<std::string> directories_;
+  };
+
+} // namespace dotnamecpp::utils
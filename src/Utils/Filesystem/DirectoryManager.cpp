@@ -1,4 +1,5 @@
 #include "DirectoryManager.hpp"
+#include "DirectoryCache.hpp"
 #include <fmt/core.h>
 #include <system_error>
 
@@ -25,6 +26,7 @@ namespace dotnamecpp::utils {
       };
     }
 
+    DirectoryCache::shared().insert(dirPath);
     return {};
   }
 
@@ -56,6 +58,7 @@ namespace dotnamecpp::utils {
     }
 
     std::filesystem::remove(dirPath, ec);
+    DirectoryCache::shared().invalidate(dirPath);
 
     if (ec) {
       return FileError{
@@ -87,7 +90,9 @@ namespace dotnamecpp::utils {
       };
     }
 
+    // Invalidated even on failure, which may leave the tree partially removed
     auto removed = std::filesystem::remove_all(dirPath, ec);
+    DirectoryCache::shared().invalidate(dirPath);
 
     if (ec) {
       return FileError{
@@ -100,6 +105,21 @@ namespace dotnamecpp::utils {
     return removed;
   }
 
+  Result<std::uintmax_t, FileError>
+      DirectoryManager::copyDirectory(const std::filesystem::path &source,
+                                      const std::filesystem::path &destination,
+                                      const CopyOptions &options) const {
+    if (source.empty() || destination.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty directory path",
+          .path = source.empty() ? "" : source.string(),
+      };
+    }
+
+    return copyTree(source, destination, options);
+  }
+
   bool DirectoryManager::exists(const std::filesystem::path &dirPath) const {
     std::error_code ec;
     return std::filesystem::is_directory(dirPath, ec) && !ec;
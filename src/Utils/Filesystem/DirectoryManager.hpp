@@ -27,6 +27,11 @@ namespace dotnamecpp::utils {
     Result<std::uintmax_t, FileError>
         removeDirectoryRecursive(const std::filesystem::path &dirPath) const override;
 
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> copyDirectory(const std::filesystem::path &source,
+                                                    const std::filesystem::path &destination,
+                                                    const CopyOptions &options = {}) const override;
+
     [[nodiscard]]
     bool exists(const std::filesystem::path &dirPath) const override;
 
@@ -0,0 +1,295 @@
+#include "FileAppender.hpp"
+#include "FileDescriptor.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef _WIN32
+#include <fstream>
+#endif
+
+namespace dotnamecpp::utils {
+
+  struct FileAppenderState {
+    std::filesystem::path path;
+    AppenderOptions options;
+    mutable std::mutex mutex;
+#ifndef _WIN32
+    FileDescriptor fd;
+#else
+    std::ofstream file;
+#endif
+    std::string buffer;
+    // When the oldest buffered byte was appended
+    std::chrono::steady_clock::time_point pendingSince;
+    // Failure of a background flush, reported by the next append() or flush()
+    std::optional<FileError> backgroundError;
+    bool closed = false;
+
+    // Caller holds mutex; written receives the number of bytes that reached the file
+    std::optional<FileError> writeOut(std::string_view data, std::size_t &written) {
+#ifndef _WIN32
+      written = writeFully(fd.get(), data.data(), data.size());
+      if (written < data.size()) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to append to file",
+                                  path);
+      }
+#else
+      file.write(data.data(), static_cast<std::streamsize>(data.size()));
+      file.flush();
+      written = file ? data.size() : 0;
+      if (!file) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while appending to file",
+            .path = path.string(),
+        };
+      }
+#endif
+      return std::nullopt;
+    }
+
+    // Caller holds mutex; data that could not be written stays buffered
+    std::optional<FileError> flushLocked() {
+      if (buffer.empty()) {
+        return std::nullopt;
+      }
+      std::size_t written = 0;
+      auto error = writeOut(buffer, written);
+      buffer.erase(0, written);
+      return error;
+    }
+  };
+
+  namespace {
+
+    /**
+     * @brief Background thread flushing appenders whose flushInterval has elapsed
+     *
+     * Holds the appenders weakly, so a destroyed appender simply drops out.
+     */
+    class PeriodicFlusher final {
+    public:
+      static PeriodicFlusher &instance() {
+        static PeriodicFlusher flusher;
+        return flusher;
+      }
+
+      PeriodicFlusher(const PeriodicFlusher &) = delete;
+      PeriodicFlusher &operator=(const PeriodicFlusher &) = delete;
+      PeriodicFlusher(PeriodicFlusher &&) = delete;
+      PeriodicFlusher &operator=(PeriodicFlusher &&) = delete;
+
+      ~PeriodicFlusher() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          stopping_ = true;
+        }
+        condition_.notify_one();
+        thread_.join();
+      }
+
+      void add(const std::shared_ptr<FileAppenderState> &state) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        appenders_.push_back(state);
+      }
+
+      // Recompute the next deadline; must not be called while holding an appender's mutex
+      void wake() {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          wakeRequested_ = true;
+        }
+        condition_.notify_one();
+      }
+
+    private:
+      PeriodicFlusher() : thread_([this] { run(); }) {}
+
+      void run() {
+        using Clock = std::chrono::steady_clock;
+        auto deadline = Clock::time_point::max();
+        std::vector<std::shared_ptr<FileAppenderState>> states;
+
+        for (;;) {
+          states.clear();
+          {
+            std::unique_lock<std::mutex> lock(mutex_);
+            const auto woken = [this] { return stopping_ || wakeRequested_; };
+            if (deadline == Clock::time_point::max()) {
+              condition_.wait(lock, woken);
+            } else {
+              condition_.wait_until(lock, deadline, woken);
+            }
+            if (stopping_) {
+              return;
+            }
+            wakeRequested_ = false;
+            std::erase_if(appenders_, [](const auto &appender) { return appender.expired(); });
+            for (const auto &appender : appenders_) {
+              if (auto state = appender.lock()) {
+                states.push_back(std::move(state));
+              }
+            }
+          }
+
+          // Flush outside mutex_, so appenders waking this thread never wait on file I/O
+          deadline = Clock::time_point::max();
+          const auto now = Clock::now();
+          for (const auto &state : states) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (state->closed || state->buffer.empty()) {
+              continue;
+            }
+            if (state->pendingSince + state->options.flushInterval <= now) {
+              if (auto error = state->flushLocked(); error && !state->backgroundError) {
+                state->backgroundError = std::move(error);
+              }
+              if (state->buffer.empty()) {
+                continue;
+              }
+              state->pendingSince = now; // Retry what could not be written after an interval
+            }
+            deadline = std::min(deadline, state->pendingSince + state->options.flushInterval);
+          }
+        }
+      }
+
+      std::mutex mutex_;
+      std::condition_variable condition_;
+      std::vector<std::weak_ptr<FileAppenderState>> appenders_;
+      bool wakeRequested_ = false;
+      bool stopping_ = false;
+      std::thread thread_; // Last, so it starts after the members it uses
+    };
+
+  } // namespace
+
+  Result<std::unique_ptr<FileAppender>, FileError>
+      FileAppender::open(const std::filesystem::path &filePath, const AppenderOptions &options) {
+    auto state = std::make_shared<FileAppenderState>();
+    state->path = filePath;
+    state->options = options;
+
+#ifndef _WIN32
+    state->fd = FileDescriptor::open(filePath, O_WRONLY | O_APPEND | O_CREAT);
+    if (!state->fd) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                "Failed to open file for appending", filePath);
+    }
+#else
+    state->file.open(filePath, std::ios::binary | std::ios::app);
+    if (!state->file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Failed to open file for appending",
+          .path = filePath.string(),
+      };
+    }
+#endif
+
+    state->buffer.reserve(options.bufferSize);
+    if (options.flushInterval.count() > 0) {
+      PeriodicFlusher::instance().add(state);
+    }
+    return std::unique_ptr<FileAppender>(new FileAppender(std::move(state)));
+  }
+
+  FileAppender::FileAppender(std::shared_ptr<FileAppenderState> state)
+      : state_(std::move(state)) {}
+
+  FileAppender::~FileAppender() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    [[maybe_unused]] const auto error = state_->flushLocked();
+    state_->closed = true;
+#ifndef _WIN32
+    state_->fd.reset();
+#else
+    state_->file.close();
+#endif
+  }
+
+  Result<void, FileError> FileAppender::append(std::string_view data) {
+    return appendParts(data, {});
+  }
+
+  Result<void, FileError> FileAppender::appendLine(std::string_view line) {
+    return appendParts(line, "\n");
+  }
+
+  Result<void, FileError> FileAppender::appendParts(std::string_view data,
+                                                    std::string_view suffix) {
+    auto &state = *state_;
+    bool startedPending = false;
+    std::optional<FileError> error;
+    {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      // The data is buffered even when an earlier background flush failed; that failure is
+      // reported instead of this append's own
+      if (auto earlier = std::exchange(state.backgroundError, std::nullopt)) {
+        error = std::move(earlier);
+      }
+
+      const bool wasEmpty = state.buffer.empty();
+      if (wasEmpty && suffix.empty() && data.size() >= state.options.bufferSize) {
+        // Large appends go straight to the file instead of through the buffer; as in
+        // flushLocked(), a tail that could not be written stays buffered
+        std::size_t written = 0;
+        auto writeError = state.writeOut(data, written);
+        state.buffer.append(data.substr(written));
+        if (!error) {
+          error = std::move(writeError);
+        }
+      } else {
+        state.buffer.append(data);
+        state.buffer.append(suffix);
+        if (state.buffer.size() >= state.options.bufferSize) {
+          if (auto flushError = state.flushLocked(); !error) {
+            error = std::move(flushError);
+          }
+        }
+      }
+      if (wasEmpty && !state.buffer.empty()) {
+        state.pendingSince = std::chrono::steady_clock::now();
+        startedPending = state.options.flushInterval.count() > 0;
+      }
+    }
+
+    if (startedPending) {
+      PeriodicFlusher::instance().wake();
+    }
+    if (error) {
+      return *error;
+    }
+    return {};
+  }
+
+  Result<void, FileError> FileAppender::flush() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    // Write what is buffered even when an earlier background flush failed, then report that
+    // earlier failure first
+    auto error = state_->flushLocked();
+    if (auto earlier = std::exchange(state_->backgroundError, std::nullopt)) {
+      return *earlier;
+    }
+    if (error) {
+      return *error;
+    }
+    return {};
+  }
+
+  std::size_t FileAppender::pendingBytes() const {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    return state_->buffer.size();
+  }
+
+  const std::filesystem::path &FileAppender::path() const noexcept {
+    return state_->path;
+  }
+
+} // namespace dotnamecpp::utils
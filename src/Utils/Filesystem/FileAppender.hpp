@@ -0,0 +1,59 @@
+#pragma once
+
+#include <Utils/Filesystem/IFileAppender.hpp>
+#include <memory>
+
+namespace dotnamecpp::utils {
+
+  struct FileAppenderState;
+
+  /**
+   * @brief IFileAppender over a persistently open file
+   *
+   * Time-based flushes run on one process-wide background thread shared by all appenders;
+   * an error of such a flush is reported by the next append() or flush().
+   */
+  class FileAppender final : public IFileAppender {
+  public:
+    /**
+     * @brief Open a file for appending, creating it if missing
+     *
+     * @param filePath
+     * @param options
+     * @return Result<std::unique_ptr<FileAppender>, FileError>
+     */
+    [[nodiscard]]
+    static Result<std::unique_ptr<FileAppender>, FileError>
+        open(const std::filesystem::path &filePath, const AppenderOptions &options = {});
+
+    FileAppender(const FileAppender &) = delete;
+    FileAppender &operator=(const FileAppender &) = delete;
+    FileAppender(FileAppender &&) = delete;
+    FileAppender &operator=(FileAppender &&) = delete;
+    ~FileAppender() override;
+
+    [[nodiscard]]
+    Result<void, FileError> append(std::string_view data) override;
+
+    [[nodiscard]]
+    Result<void, FileError> appendLine(std::string_view line) override;
+
+    [[nodiscard]]
+    Result<void, FileError> flush() override;
+
+    [[nodiscard]]
+    std::size_t pendingBytes() const override;
+
+    [[nodiscard]]
+    const std::filesystem::path &path() const noexcept override;
+
+  private:
+    explicit FileAppender(std::shared_ptr<FileAppenderState> state);
+
+    Result<void, FileError> appendParts(std::string_view data, std::string_view suffix);
+
+    // Shared with the background flusher, which only holds it weakly
+    std::shared_ptr<FileAppenderState> state_;
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,294 @@
+#include "FileCopy.hpp"
+#include "FileDescriptor.hpp"
+#include <fmt/core.h>
+#include <system_error>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+#ifdef __linux__
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <sys/sendfile.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+  namespace {
+
+#ifndef _WIN32
+
+    // Largest request of one copy_file_range / sendfile call
+    constexpr std::size_t kKernelChunkSize = std::size_t{1} << 30;
+    constexpr std::size_t kBufferSize = 128 * 1024;
+
+    bool reflink([[maybe_unused]] int in, [[maybe_unused]] int out,
+                 [[maybe_unused]] const CopyOptions &options) {
+#ifdef FICLONE
+      return options.allowReflink && ::ioctl(out, FICLONE, in) == 0;
+#else
+      return false;
+#endif
+    }
+
+    // The kernel copy steps return false when they cannot finish; copied then tells where
+    // the next step has to continue
+    bool copyInKernel([[maybe_unused]] int in, [[maybe_unused]] int out,
+                      [[maybe_unused]] std::uintmax_t size, [[maybe_unused]] std::uintmax_t &copied,
+                      [[maybe_unused]] CopyMethod method) {
+#ifdef __linux__
+      if (method == CopyMethod::Sendfile &&
+          ::lseek(out, static_cast<off_t>(copied), SEEK_SET) < 0) {
+        return false;
+      }
+      for (;;) {
+        auto inOffset = static_cast<off_t>(copied);
+        auto outOffset = static_cast<off_t>(copied);
+        const ssize_t count =
+            method == CopyMethod::CopyFileRange
+                ? ::copy_file_range(in, &inOffset, out, &outOffset, kKernelChunkSize, 0)
+                : ::sendfile(out, in, &inOffset, kKernelChunkSize);
+        if (count < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return false;
+        }
+        if (count == 0) {
+          // Some pseudo filesystems report no data at all; let the buffered loop verify
+          return copied >= size;
+        }
+        copied += static_cast<std::uintmax_t>(count);
+      }
+#else
+      return false;
+#endif
+    }
+
+    std::optional<FileError> copyBuffered(int in, int out, std::uintmax_t &copied,
+                                          const std::filesystem::path &source,
+                                          const std::filesystem::path &destination) {
+      if (::lseek(out, static_cast<off_t>(copied), SEEK_SET) < 0) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "Failed to seek destination file", destination);
+      }
+      std::vector<char> buffer(kBufferSize);
+      for (;;) {
+        const ssize_t received =
+            preadFully(in, buffer.data(), buffer.size(), static_cast<off_t>(copied));
+        if (received < 0) {
+          return fileErrorFromErrno(errno, FileErrorCode::ReadError,
+                                    "Failed to read source file", source);
+        }
+        if (received == 0) {
+          return std::nullopt;
+        }
+        const auto count = static_cast<std::size_t>(received);
+        if (writeFully(out, buffer.data(), count) != count) {
+          return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                    "Failed to write destination file", destination);
+        }
+        copied += count;
+      }
+    }
+
+    Result<CopyStats, FileError> copyContents(int in, int out, std::uintmax_t size,
+                                              const CopyOptions &options,
+                                              const std::filesystem::path &source,
+                                              const std::filesystem::path &destination) {
+      if (reflink(in, out, options)) {
+        return CopyStats{.bytes = size, .method = CopyMethod::Reflink};
+      }
+
+      std::uintmax_t copied = 0;
+      for (const auto method : {CopyMethod::CopyFileRange, CopyMethod::Sendfile}) {
+        if (copyInKernel(in, out, size, copied, method)) {
+          return CopyStats{.bytes = copied, .method = method};
+        }
+      }
+
+      if (auto error = copyBuffered(in, out, copied, source, destination)) {
+        return *error;
+      }
+      return CopyStats{.bytes = copied, .method = CopyMethod::Buffered};
+    }
+
+#endif // _WIN32
+
+  } // namespace
+
+  Result<CopyStats, FileError> copyFile(const std::filesystem::path &source,
+                                        const std::filesystem::path &destination,
+                                        const CopyOptions &options) {
+#ifndef _WIN32
+    const auto in = FileDescriptor::open(source, O_RDONLY);
+    if (!in) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "Failed to open source file",
+                                source);
+    }
+
+    struct stat sourceInfo{};
+    if (::fstat(in.get(), &sourceInfo) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "Failed to stat source file",
+                                source);
+    }
+    if (S_ISDIR(sourceInfo.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Source is a directory, not a file",
+          .path = source.string(),
+      };
+    }
+    if (!S_ISREG(sourceInfo.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Source is not a regular file",
+          .path = source.string(),
+      };
+    }
+
+    // Truncating the destination would otherwise destroy the source
+    struct stat destinationInfo{};
+    const bool existed = ::stat(destination.c_str(), &destinationInfo) == 0;
+    if (existed && destinationInfo.st_dev == sourceInfo.st_dev &&
+        destinationInfo.st_ino == sourceInfo.st_ino) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Source and destination are the same file",
+          .path = destination.string(),
+      };
+    }
+
+    const mode_t permissions = sourceInfo.st_mode & 07777;
+    const auto out = FileDescriptor::open(
+        destination, O_WRONLY | O_CREAT | (options.overwrite ? O_TRUNC : O_EXCL), permissions);
+    if (!out) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                "Failed to open destination file", destination);
+    }
+
+    auto stats = copyContents(in.get(), out.get(), static_cast<std::uintmax_t>(sourceInfo.st_size),
+                              options, source, destination);
+    if (!stats) {
+      if (!existed) {
+        ::unlink(destination.c_str());
+      }
+      return stats;
+    }
+    // The umask applies to created files and an existing destination keeps its own mode
+    ::fchmod(out.get(), permissions);
+    return stats;
+#else
+    std::error_code ec;
+    if (std::filesystem::is_directory(source, ec)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Source is a directory, not a file",
+          .path = source.string(),
+      };
+    }
+    if (std::filesystem::exists(destination, ec) &&
+        std::filesystem::equivalent(source, destination, ec)) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Source and destination are the same file",
+          .path = destination.string(),
+      };
+    }
+
+    // CopyFile2 underneath; reported as Buffered
+    const auto copyOptions = options.overwrite ? std::filesystem::copy_options::overwrite_existing
+                                               : std::filesystem::copy_options::none;
+    std::filesystem::copy_file(source, destination, copyOptions, ec);
+    if (ec) {
+      return FileError{
+          .code = ec == std::errc::file_exists ? FileErrorCode::AlreadyExists
+                                               : FileErrorCode::WriteError,
+          .message = fmt::format("Failed to copy file: {}", ec.message()),
+          .path = destination.string(),
+      };
+    }
+    const auto size = std::filesystem::file_size(destination, ec);
+    return CopyStats{.bytes = ec ? 0 : size, .method = CopyMethod::Buffered};
+#endif
+  }
+
+  Result<std::uintmax_t, FileError> copyTree(const std::filesystem::path &source,
+                                             const std::filesystem::path &destination,
+                                             const CopyOptions &options) {
+    std::error_code ec;
+    if (!std::filesystem::is_directory(source, ec) || ec) {
+      return FileError{
+          .code = std::filesystem::exists(source, ec) ? FileErrorCode::NotDirectory
+                                                      : FileErrorCode::NotFound,
+          .message = "Source is not a directory",
+          .path = source.string(),
+      };
+    }
+
+    // A destination inside the source would be copied into itself while iterating
+    const auto sourceRoot = std::filesystem::weakly_canonical(source, ec);
+    const auto destinationRoot = std::filesystem::weakly_canonical(destination, ec);
+    const auto relative = destinationRoot.lexically_relative(sourceRoot);
+    if (!ec && !relative.empty() && *relative.begin() != "..") {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Destination lies inside the source directory",
+          .path = destination.string(),
+      };
+    }
+
+    std::filesystem::create_directories(destination, ec);
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = fmt::format("Failed to create directory: {}", ec.message()),
+          .path = destination.string(),
+      };
+    }
+
+    std::uintmax_t copied = 0;
+    std::filesystem::recursive_directory_iterator it(source, ec);
+    for (; !ec && it != std::filesystem::recursive_directory_iterator(); it.increment(ec)) {
+      const auto target = destination / it->path().lexically_relative(source);
+      const auto status = it->symlink_status(ec);
+      if (ec) {
+        break;
+      }
+
+      if (std::filesystem::is_symlink(status)) {
+        if (options.overwrite) {
+          std::filesystem::remove(target, ec);
+        }
+        std::filesystem::copy_symlink(it->path(), target, ec);
+      } else if (std::filesystem::is_directory(status)) {
+        std::filesystem::create_directory(target, ec);
+      } else if (std::filesystem::is_regular_file(status)) {
+        if (auto result = copyFile(it->path(), target, options); !result) {
+          return result.error();
+        }
+        ++copied;
+      }
+
+      if (ec) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = fmt::format("Failed to copy directory entry: {}", ec.message()),
+            .path = target.string(),
+        };
+      }
+    }
+
+    if (ec) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = fmt::format("Failed to traverse directory: {}", ec.message()),
+          .path = source.string(),
+      };
+    }
+    return copied;
+  }
+
+} // namespace dotnamecpp::utils
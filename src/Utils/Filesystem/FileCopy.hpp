@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstdint>
+#include <filesystem>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief How a file copy reached the destination
+   *
+   */
+  enum class CopyMethod : std::uint8_t {
+    Reflink,       // FICLONE: destination shares the source's extents copy-on-write
+    CopyFileRange, // copy_file_range: data copied inside the kernel / filesystem
+    Sendfile,      // sendfile: data copied inside the kernel through the page cache
+    Buffered,      // read/write loop through a user-space buffer
+  };
+
+  /**
+   * @brief Options of copyFile() and copyTree()
+   *
+   */
+  struct CopyOptions {
+    // Replace existing destination files instead of failing with AlreadyExists
+    bool overwrite = false;
+    // Allow the destination to share storage with the source where the filesystem can
+    bool allowReflink = true;
+  };
+
+  /**
+   * @brief Outcome of a successful copyFile()
+   *
+   */
+  struct CopyStats {
+    std::uintmax_t bytes = 0;
+    CopyMethod method = CopyMethod::Buffered;
+  };
+
+  /**
+   * @brief Copy a regular file, keeping the data out of user space where possible
+   *
+   * Tries, in order, a FICLONE reflink, copy_file_range, sendfile and a buffered read/write
+   * loop; each step picks up where a failing one stopped. The destination gets the source's
+   * permission bits. A destination created by the call is removed again if the copy fails.
+   *
+   * @param source
+   * @param destination
+   * @param options
+   * @return Result<CopyStats, FileError>
+   */
+  [[nodiscard]]
+  Result<CopyStats, FileError> copyFile(const std::filesystem::path &source,
+                                        const std::filesystem::path &destination,
+                                        const CopyOptions &options = {});
+
+  /**
+   * @brief Copy a directory tree with copyFile(), recreating directories and symlinks
+   *
+   * Other file types (sockets, devices, FIFOs) are skipped.
+   *
+   * @param source
+   * @param destination Created if missing
+   * @param options
+   * @return Result<std::uintmax_t, FileError> Number of files copied
+   */
+  [[nodiscard]]
+  Result<std::uintmax_t, FileError> copyTree(const std::filesystem::path &source,
+                                             const std::filesystem::path &destination,
+                                             const CopyOptions &options = {});
+
+} // namespace dotnamecpp::utils
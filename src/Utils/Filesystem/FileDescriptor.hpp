@@ -0,0 +1,218 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cerrno>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Build a FileError from an errno value
+   *
+   * @param error errno value
+   * @param fallback Code used when errno has no more specific FileErrorCode
+   * @param message
+   * @param filePath
+   * @return FileError
+   */
+  inline FileError fileErrorFromErrno(int error, FileErrorCode fallback,
+                                      const std::string &message,
+                                      const std::filesystem::path &filePath) {
+    FileErrorCode code = fallback;
+    switch (error) {
+    case ENOENT:
+    case ENOTDIR: code = FileErrorCode::NotFound; break;
+    case EACCES:
+    case EPERM: code = FileErrorCode::AccessDenied; break;
+    case EISDIR: code = FileErrorCode::IsDirectory; break;
+    case EEXIST: code = FileErrorCode::AlreadyExists; break;
+    case ENAMETOOLONG:
+    case ELOOP: code = FileErrorCode::InvalidPath; break;
+    default: break;
+    }
+    return FileError{
+        .code = code,
+        .message = message + ": " + std::generic_category().message(error),
+        .path = filePath.string(),
+    };
+  }
+
+#ifndef _WIN32
+
+  /**
+   * @brief Owning wrapper of a POSIX file descriptor
+   *
+   */
+  class FileDescriptor final {
+  public:
+    FileDescriptor() = default;
+    explicit FileDescriptor(int fd) noexcept : fd_(fd) {}
+    ~FileDescriptor() { reset(); }
+
+    FileDescriptor(const FileDescriptor &) = delete;
+    FileDescriptor &operator=(const FileDescriptor &) = delete;
+    FileDescriptor(FileDescriptor &&other) noexcept : fd_(std::exchange(other.fd_, -1)) {}
+    FileDescriptor &operator=(FileDescriptor &&other) noexcept {
+      if (this != &other) {
+        reset(std::exchange(other.fd_, -1));
+      }
+      return *this;
+    }
+
+    /**
+     * @brief Open a file, retrying on EINTR; O_CLOEXEC is always added
+     *
+     * @param filePath
+     * @param flags open(2) flags
+     * @param mode Permissions for newly created files
+     * @return FileDescriptor, invalid on failure with errno set
+     */
+    static FileDescriptor open(const std::filesystem::path &filePath, int flags,
+                               mode_t mode = 0644) {
+      int fd = -1;
+      do {
+        fd = ::open(filePath.c_str(), flags | O_CLOEXEC, mode);
+      } while (fd < 0 && errno == EINTR);
+      return FileDescriptor(fd);
+    }
+
+    [[nodiscard]]
+    int get() const noexcept {
+      return fd_;
+    }
+
+    [[nodiscard]]
+    explicit operator bool() const noexcept {
+      return fd_ >= 0;
+    }
+
+    int release() noexcept { return std::exchange(fd_, -1); }
+
+    void reset(int fd = -1) noexcept {
+      if (fd_ >= 0) {
+        ::close(fd_);
+      }
+      fd_ = fd;
+    }
+
+  private:
+    int fd_ = -1;
+  };
+
+  /**
+   * @brief Read until count bytes were read or end of file is reached, retrying on EINTR
+   *
+   * @param fd
+   * @param buffer
+   * @param count
+   * @return Number of bytes read, or -1 with errno set
+   */
+  inline ssize_t readFully(int fd, void *buffer, std::size_t count) {
+    auto *out = static_cast<char *>(buffer);
+    std::size_t total = 0;
+    while (total < count) {
+      const ssize_t received = ::read(fd, out + total, count - total);
+      if (received < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return -1;
+      }
+      if (received == 0) {
+        break;
+      }
+      total += static_cast<std::size_t>(received);
+    }
+    return static_cast<ssize_t>(total);
+  }
+
+  /**
+   * @brief Positional variant of readFully; does not move the file offset
+   *
+   * @param fd
+   * @param buffer
+   * @param count
+   * @param offset
+   * @return Number of bytes read, or -1 with errno set
+   */
+  inline ssize_t preadFully(int fd, void *buffer, std::size_t count, off_t offset) {
+    auto *out = static_cast<char *>(buffer);
+    std::size_t total = 0;
+    while (total < count) {
+      const ssize_t received =
+          ::pread(fd, out + total, count - total, offset + static_cast<off_t>(total));
+      if (received < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return -1;
+      }
+      if (received == 0) {
+        break;
+      }
+      total += static_cast<std::size_t>(received);
+    }
+    return static_cast<ssize_t>(total);
+  }
+
+  /**
+   * @brief Write all count bytes, retrying on EINTR and short writes
+   *
+   * @param fd
+   * @param data
+   * @param count
+   * @return Number of bytes written, less than count only on error with errno set
+   */
+  inline std::size_t writeFully(int fd, const void *data, std::size_t count) {
+    const auto *in = static_cast<const char *>(data);
+    std::size_t total = 0;
+    while (total < count) {
+      const ssize_t written = ::write(fd, in + total, count - total);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        break;
+      }
+      total += static_cast<std::size_t>(written);
+    }
+    return total;
+  }
+
+  /**
+   * @brief Positional variant of writeFully; does not move the file offset
+   *
+   * @param fd
+   * @param data
+   * @param count
+   * @param offset
+   * @return Number of bytes written, less than count only on error with errno set
+   */
+  inline std::size_t pwriteFully(int fd, const void *data, std::size_t count, off_t offset) {
+    const auto *in = static_cast<const char *>(data);
+    std::size_t total = 0;
+    while (total < count) {
+      const ssize_t written =
+          ::pwrite(fd, in + total, count - total, offset + static_cast<off_t>(total));
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        break;
+      }
+      total += static_cast<std::size_t>(written);
+    }
+    return total;
+  }
+
+#endif // _WIN32
+
+} // namespace dotnamecpp::utils
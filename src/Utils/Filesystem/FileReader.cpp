@@ -1,16 +1,399 @@
 #include "FileReader.hpp"
+#include <Utils/Filesystem/FileDescriptor.hpp>
+#include <Utils/Filesystem/IoThreadPool.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <fmt/core.h>
 #include <fstream>
+#include <future>
+#include <memory_resource>
+#include <mutex>
 #include <sstream>
 #include <system_error>
+#include <thread>
+#include <type_traits>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
 
 namespace dotnamecpp::utils {
 
+#ifndef _WIN32
+  namespace {
+
+    // Open a file and fstat the descriptor, rejecting directories
+    std::optional<FileError> openForReading(const std::filesystem::path &filePath,
+                                            FileDescriptor &fd, struct stat &info) {
+      fd = FileDescriptor::open(filePath, O_RDONLY);
+      if (!fd) {
+        return fileErrorFromErrno(errno, FileErrorCode::ReadError,
+                                  "Failed to open file for reading", filePath);
+      }
+      if (::fstat(fd.get(), &info) != 0) {
+        return fileErrorFromErrno(errno, FileErrorCode::ReadError, "Failed to stat file",
+                                  filePath);
+      }
+      if (S_ISDIR(info.st_mode)) {
+        return FileError{
+            .code = FileErrorCode::IsDirectory,
+            .message = "Path is a directory, not a file",
+            .path = filePath.string(),
+        };
+      }
+      return std::nullopt;
+    }
+
+    // Read the rest of a descriptor whose size is not known up front (pipes, procfs, ...)
+    template <typename Buffer>
+    bool readUntilEof(int fd, Buffer &buffer) {
+      constexpr std::size_t kChunkSize = 64 * 1024;
+      for (;;) {
+        const std::size_t used = buffer.size();
+        buffer.resize(used + kChunkSize);
+        const ssize_t received = readFully(fd, buffer.data() + used, kChunkSize);
+        if (received < 0) {
+          buffer.resize(used);
+          return false;
+        }
+        buffer.resize(used + static_cast<std::size_t>(received));
+        if (static_cast<std::size_t>(received) < kChunkSize) {
+          return true;
+        }
+      }
+    }
+
+    // Drop a completely read file from the page cache if it is large enough to count as
+    // one-off input (FileReaderOptions::dropCacheThreshold)
+    void dropIfLarge(int fd, std::uintmax_t size, std::uintmax_t dropCacheThreshold) {
+      if (dropCacheThreshold != 0 && size >= dropCacheThreshold) {
+        dropCachedPages(fd);
+      }
+    }
+
+    /**
+     * @brief Read a whole file with one fstat and a single pre-sized read loop
+     *
+     * Missing files, permission problems and directories are reported from open() and fstat()
+     * on the descriptor, so no separate stat of the path is needed. Regular files are read up
+     * to the size reported by fstat; a file that shrinks in the meantime yields the shorter
+     * content. Files without a meaningful size are read in chunks until end of file.
+     */
+    template <typename Buffer>
+    std::optional<FileError> readWholeFile(const std::filesystem::path &filePath, Buffer &buffer,
+                                           std::uintmax_t dropCacheThreshold) {
+      FileDescriptor fd;
+      struct stat info {};
+      if (auto error = openForReading(filePath, fd, info)) {
+        return error;
+      }
+
+      if (!S_ISREG(info.st_mode) || info.st_size == 0) {
+        if (!readUntilEof(fd.get(), buffer)) {
+          return fileErrorFromErrno(errno, FileErrorCode::ReadError,
+                                    "I/O error while reading file", filePath);
+        }
+        return std::nullopt;
+      }
+
+      const auto size = static_cast<std::size_t>(info.st_size);
+      ssize_t received = 0;
+      if constexpr (std::is_same_v<Buffer, std::string> ||
+                    std::is_same_v<Buffer, std::pmr::string>) {
+#if defined(__cpp_lib_string_resize_and_overwrite)
+        // C++23 only: allocate once without zero-filling the bytes that read() overwrites anyway
+        buffer.resize_and_overwrite(size, [&](char *data, std::size_t count) {
+          received = readFully(fd.get(), data, count);
+          return received < 0 ? 0 : static_cast<std::size_t>(received);
+        });
+#else
+        // C++20, the project's standard, cannot size a string without zero-filling it first
+        buffer.resize(size);
+        received = readFully(fd.get(), buffer.data(), size);
+#endif
+      } else {
+        buffer.resize(size);
+        received = readFully(fd.get(), buffer.data(), size);
+      }
+
+      if (received < 0) {
+        return fileErrorFromErrno(errno, FileErrorCode::ReadError, "I/O error while reading file",
+                                  filePath);
+      }
+      buffer.resize(static_cast<std::size_t>(received));
+      dropIfLarge(fd.get(), size, dropCacheThreshold);
+      return std::nullopt;
+    }
+
+    struct ByteRange {
+      std::uintmax_t offset;
+      std::size_t length;
+    };
+
+    // Split a file into at most `parallelism` ranges of at least minRangeSize bytes, aligned
+    // to 64 KiB so neighbouring workers never share a page
+    std::vector<ByteRange> splitRanges(std::uintmax_t size, const ParallelReadOptions &options,
+                                       std::size_t poolSize) {
+      constexpr std::uintmax_t kAlignment = 64 * 1024;
+      const std::uintmax_t parallelism =
+          std::max<std::size_t>(options.parallelism == 0 ? poolSize : options.parallelism, 1);
+      const std::uintmax_t minRange = std::max<std::uintmax_t>(options.minRangeSize, 1);
+      const std::uintmax_t count = std::clamp<std::uintmax_t>(size / minRange, 1, parallelism);
+      const std::uintmax_t step =
+          ((size + count - 1) / count + kAlignment - 1) / kAlignment * kAlignment;
+
+      std::vector<ByteRange> ranges;
+      for (std::uintmax_t offset = 0; offset < size; offset += step) {
+        ranges.push_back({offset, static_cast<std::size_t>(std::min(step, size - offset))});
+      }
+      return ranges;
+    }
+
+    /**
+     * @brief Run a task per range, all but the first on the pool, and wait for all of them
+     *
+     * Called from one of the pool's own workers, the ranges run one after another on the
+     * calling thread, since waiting for the pool from inside it can deadlock. An exception
+     * thrown by a task is rethrown once every task has finished, as they all refer to the
+     * caller's locals.
+     *
+     * @return The first non-zero errno reported by a task, 0 on success
+     */
+    template <typename Task>
+    int runRanges(IoThreadPool &pool, const std::vector<ByteRange> &ranges, Task &&task) {
+      int error = 0;
+      if (pool.isWorkerThread()) {
+        for (const auto &range : ranges) {
+          if (const int rangeError = task(range); error == 0) {
+            error = rangeError;
+          }
+        }
+        return error;
+      }
+      if (ranges.empty()) {
+        return 0;
+      }
+
+      std::vector<std::future<int>> pending;
+      pending.reserve(ranges.size() - 1);
+      for (std::size_t i = 1; i < ranges.size(); ++i) {
+        pending.push_back(pool.submit([&task, range = ranges[i]] { return task(range); }));
+      }
+      // The calling thread reads the first range instead of idling
+      std::exception_ptr failure;
+      try {
+        error = task(ranges.front());
+      } catch (...) {
+        failure = std::current_exception();
+      }
+      for (auto &future : pending) {
+        try {
+          if (const int rangeError = future.get(); error == 0) {
+            error = rangeError;
+          }
+        } catch (...) {
+          if (!failure) {
+            failure = std::current_exception();
+          }
+        }
+      }
+      if (failure) {
+        std::rethrow_exception(failure);
+      }
+      return error;
+    }
+
+  } // namespace
+#endif
+
+  namespace {
+
+    /**
+     * @brief Split a stream into lines through one reused buffer
+     *
+     * @param readChunk Callable filling (data, size), returning the bytes read, 0 at end of
+     * file or a negative value on error
+     * @return false on a read error
+     */
+    template <typename ReadChunk>
+    bool streamLines(ReadChunk &&readChunk, std::size_t chunkSize,
+                     const IFileReader::LineCallback &callback, std::size_t &lineCount) {
+      std::vector<char> buffer(std::max<std::size_t>(chunkSize, 1));
+      std::size_t carry = 0; // Bytes of an unterminated line kept from the previous chunk
+      for (;;) {
+        if (carry == buffer.size()) {
+          buffer.resize(buffer.size() * 2); // Line longer than the buffer
+        }
+        const auto received = readChunk(buffer.data() + carry, buffer.size() - carry);
+        if (received < 0) {
+          return false;
+        }
+
+        std::string_view rest(buffer.data(), carry + static_cast<std::size_t>(received));
+        std::string_view line;
+        if (received == 0) {
+          if (!rest.empty()) {
+            LineView::takeLine(rest, line);
+            ++lineCount;
+            callback(line);
+          }
+          return true;
+        }
+
+        std::string_view remaining = rest;
+        while (LineView::takeLine(remaining, line)) {
+          rest = remaining;
+          ++lineCount;
+          if (!callback(line)) {
+            return true;
+          }
+        }
+        carry = rest.size();
+        std::memmove(buffer.data(), rest.data(), carry);
+      }
+    }
+
+    /**
+     * @brief Deliver a stream in fixed-size chunks from one reused buffer
+     *
+     * @return false on a read error, with errno describing it
+     */
+    template <typename ReadChunk>
+    bool streamChunks(ReadChunk &&readChunk, std::size_t chunkSize,
+                      const IFileReader::ChunkCallback &callback, std::uintmax_t &total) {
+      std::vector<std::byte> buffer(chunkSize);
+      for (;;) {
+        const auto received = readChunk(buffer.data(), buffer.size());
+        if (received < 0) {
+          return false;
+        }
+        if (received == 0) {
+          return true;
+        }
+        const auto size = static_cast<std::size_t>(received);
+        total += size;
+        // A short chunk means end of file, no need for another read
+        if (!callback(std::span<const std::byte>(buffer.data(), size)) || size < chunkSize) {
+          return true;
+        }
+      }
+    }
+
+    /**
+     * @brief Like streamChunks, but the next chunk is read on a helper thread while the
+     * callback processes the current one
+     *
+     * Stopping early waits for the read in flight to complete.
+     */
+    template <typename ReadChunk>
+    bool streamChunksWithReadAhead(ReadChunk &&readChunk, std::size_t chunkSize,
+                                   const IFileReader::ChunkCallback &callback,
+                                   std::uintmax_t &total) {
+      struct Slot {
+        std::vector<std::byte> data;
+        std::ptrdiff_t size = 0;
+        int error = 0;
+        bool ready = false; // Filled by the reader and not yet released by the consumer
+      };
+      std::array<Slot, 2> slots;
+      for (auto &slot : slots) {
+        slot.data.resize(chunkSize);
+      }
+      std::mutex mutex;
+      std::condition_variable cv;
+      bool stop = false;
+
+      std::thread reader([&] {
+        for (std::size_t index = 0;; index ^= 1) {
+          Slot &slot = slots[index];
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return stop || !slot.ready; });
+            if (stop) {
+              return;
+            }
+          }
+          const auto received = readChunk(slot.data.data(), slot.data.size());
+          const int error = errno;
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            slot.size = static_cast<std::ptrdiff_t>(received);
+            slot.error = error;
+            slot.ready = true;
+          }
+          cv.notify_all();
+          if (received <= 0 || static_cast<std::size_t>(received) < chunkSize) {
+            return;
+          }
+        }
+      });
+
+      bool succeeded = true;
+      for (std::size_t index = 0;; index ^= 1) {
+        Slot &slot = slots[index];
+        {
+          std::unique_lock<std::mutex> lock(mutex);
+          cv.wait(lock, [&] { return slot.ready; });
+        }
+        if (slot.size < 0) {
+          errno = slot.error;
+          succeeded = false;
+          break;
+        }
+        const auto size = static_cast<std::size_t>(slot.size);
+        total += size;
+        if (size == 0 || !callback(std::span<const std::byte>(slot.data.data(), size)) ||
+            size < chunkSize) {
+          break;
+        }
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          slot.ready = false;
+        }
+        cv.notify_all();
+      }
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+      }
+      cv.notify_all();
+      reader.join();
+      return succeeded;
+    }
+
+    // Load one file into the page cache; failures are ignored, prefetching is only a hint
+    void prefetchFile(const std::filesystem::path &filePath) {
+#if !defined(_WIN32) && defined(POSIX_FADV_WILLNEED)
+      FileDescriptor fd = FileDescriptor::open(filePath, O_RDONLY);
+      struct stat info {};
+      if (fd && ::fstat(fd.get(), &info) == 0 && S_ISREG(info.st_mode)) {
+        adviseDescriptor(fd.get(), ReadHints{.willNeed = true});
+      }
+#else
+      // Without read-ahead advice, reading the file is what brings it into the cache
+      (void)FileReader().readChunks(filePath, [](std::span<const std::byte>) { return true; });
+#endif
+    }
+
+  } // namespace
+
   Result<std::string, FileError> FileReader::read(const std::filesystem::path &filePath) const {
     if (auto error = validatePath(filePath)) {
       return *error;
     }
 
+#ifndef _WIN32
+    std::string content;
+    if (auto error = readWholeFile(filePath, content, options_.dropCacheThreshold)) {
+      return *error;
+    }
+    return content;
+#else
     std::ifstream file(filePath, std::ios::in);
     if (!file.is_open()) {
       return FileError{
@@ -32,6 +415,7 @@ namespace dotnamecpp::utils {
     }
 
     return buffer.str();
+#endif
   }
 
   Result<std::vector<uint8_t>, FileError>
@@ -40,7 +424,14 @@ namespace dotnamecpp::utils {
       return *error;
     }
 
-    std::ifstream file(filePath, std::ios::binary);
+#ifndef _WIN32
+    std::vector<uint8_t> buffer;
+    if (auto error = readWholeFile(filePath, buffer, options_.dropCacheThreshold)) {
+      return *error;
+    }
+    return buffer;
+#else
+    std::ifstream file(filePath, std::ios::binary | std::ios::ate);
     if (!file.is_open()) {
       return FileError{
           .code = FileErrorCode::ReadError,
@@ -49,17 +440,72 @@ namespace dotnamecpp::utils {
       };
     }
 
-    // Get file size for pre-allocation
-    auto sizeResult = getSize(filePath);
-    if (!sizeResult) {
-      return sizeResult.error();
+    const std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    std::vector<uint8_t> buffer(size > 0 ? static_cast<size_t>(size) : 0);
+    file.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+    if (file.bad()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath.string(),
+      };
     }
 
-    std::vector<uint8_t> buffer;
-    buffer.reserve(static_cast<size_t>(sizeResult.value()));
+    buffer.resize(static_cast<size_t>(file.gcount()));
+    return buffer;
+#endif
+  }
 
-    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  Result<std::size_t, FileError> FileReader::readInto(const std::filesystem::path &filePath,
+                                                      std::span<std::byte> buffer) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+    const FileError doesNotFit{
+        .code = FileErrorCode::ReadError,
+        .message = "File does not fit into the buffer",
+        .path = filePath.string(),
+    };
+
+#ifndef _WIN32
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+    if (S_ISREG(info.st_mode) && static_cast<std::uintmax_t>(info.st_size) > buffer.size()) {
+      return doesNotFit;
+    }
 
+    const ssize_t received = readFully(fd.get(), buffer.data(), buffer.size());
+    if (received < 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "I/O error while reading file",
+                                filePath);
+    }
+    // A full buffer may hide the rest of a pipe or of a file that grew since fstat
+    if (static_cast<std::size_t>(received) == buffer.size()) {
+      std::byte probe{};
+      if (readFully(fd.get(), &probe, 1) > 0) {
+        return doesNotFit;
+      }
+    }
+    if (S_ISREG(info.st_mode)) {
+      dropIfLarge(fd.get(), static_cast<std::uintmax_t>(received), options_.dropCacheThreshold);
+    }
+    return static_cast<std::size_t>(received);
+#else
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    file.read(reinterpret_cast<char *>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
     if (file.bad()) {
       return FileError{
           .code = FileErrorCode::ReadError,
@@ -67,8 +513,491 @@ namespace dotnamecpp::utils {
           .path = filePath.string(),
       };
     }
+    const auto received = static_cast<std::size_t>(file.gcount());
+    if (received == buffer.size() && file.peek() != std::char_traits<char>::eof()) {
+      return doesNotFit;
+    }
+    return received;
+#endif
+  }
+
+  Result<std::size_t, FileError> FileReader::readInto(const std::filesystem::path &filePath,
+                                                      std::pmr::string &buffer) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+    buffer.clear();
+
+#ifndef _WIN32
+    if (auto error = readWholeFile(filePath, buffer, options_.dropCacheThreshold)) {
+      return *error;
+    }
+#else
+    auto content = read(filePath);
+    if (!content) {
+      return content.error();
+    }
+    buffer.assign(content.value());
+#endif
+    return buffer.size();
+  }
+
+  Result<BufferPool::Buffer, FileError>
+      FileReader::readPooled(const std::filesystem::path &filePath, BufferPool &pool) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+
+#ifndef _WIN32
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+    if (S_ISREG(info.st_mode) && info.st_size > 0) {
+      auto buffer = pool.acquire(static_cast<std::size_t>(info.st_size));
+      const ssize_t received = readFully(fd.get(), buffer.span().data(), buffer.size());
+      if (received < 0) {
+        return fileErrorFromErrno(errno, FileErrorCode::ReadError,
+                                  "I/O error while reading file", filePath);
+      }
+      buffer.resize(static_cast<std::size_t>(received));
+      dropIfLarge(fd.get(), buffer.size(), options_.dropCacheThreshold);
+      return buffer;
+    }
+    fd.reset();
+#endif
+
+    // Size not known up front: read normally and copy into a pooled buffer
+    auto bytes = readBytes(filePath);
+    if (!bytes) {
+      return bytes.error();
+    }
+    auto buffer = pool.acquire(bytes.value().size());
+    if (!bytes.value().empty()) {
+      std::memcpy(buffer.span().data(), bytes.value().data(), bytes.value().size());
+    }
+    return buffer;
+  }
+
+  Result<MappedFile, FileError>
+      FileReader::readMapped(const std::filesystem::path &filePath,
+                             const ReadHints &hints) const {
+    return MappedFile::open(filePath, hints);
+  }
+
+  Result<LineView, FileError>
+      FileReader::readLineView(const std::filesystem::path &filePath) const {
+    auto file = MappedFile::open(filePath);
+    if (!file) {
+      return file.error();
+    }
+    return LineView(std::move(file).value());
+  }
+
+  Result<std::size_t, FileError> FileReader::forEachLine(const std::filesystem::path &filePath,
+                                                         const LineCallback &callback,
+                                                         std::size_t chunkSize) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+
+    std::size_t lineCount = 0;
+#ifndef _WIN32
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+    const bool completed = streamLines(
+        [&fd](char *data, std::size_t size) { return readFully(fd.get(), data, size); },
+        chunkSize, callback, lineCount);
+    if (!completed) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "I/O error while reading file",
+                                filePath);
+    }
+#else
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    const bool completed = streamLines(
+        [&file](char *data, std::size_t size) -> std::streamsize {
+          file.read(data, static_cast<std::streamsize>(size));
+          return file.bad() ? -1 : file.gcount();
+        },
+        chunkSize, callback, lineCount);
+    if (!completed) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath.string(),
+      };
+    }
+#endif
+    return lineCount;
+  }
 
+  Result<std::uintmax_t, FileError> FileReader::readChunks(const std::filesystem::path &filePath,
+                                                          const ChunkCallback &callback,
+                                                          const ReadChunkOptions &options) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+    const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+
+#ifndef _WIN32
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+    adviseDescriptor(fd.get(), options.hints);
+    off_t offset = 0;
+    auto readChunk = [&fd, &offset, drop = options.hints.dropAfterRead](std::byte *data,
+                                                                        std::size_t size) {
+      const ssize_t received = readFully(fd.get(), data, size);
+      if (drop && received > 0) {
+        // The bytes are in our buffer now; their cached pages are no longer needed
+        dropCachedPages(fd.get(), offset, static_cast<off_t>(received));
+        offset += static_cast<off_t>(received);
+      }
+      return received;
+    };
+#else
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+    auto readChunk = [&file](std::byte *data, std::size_t size) -> std::streamsize {
+      file.read(reinterpret_cast<char *>(data), static_cast<std::streamsize>(size));
+      return file.bad() ? -1 : file.gcount();
+    };
+#endif
+
+    std::uintmax_t total = 0;
+    const bool completed =
+        options.readAhead ? streamChunksWithReadAhead(readChunk, chunkSize, callback, total)
+                          : streamChunks(readChunk, chunkSize, callback, total);
+    if (!completed) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "I/O error while reading file",
+                                filePath);
+    }
+    return total;
+  }
+
+  Result<std::vector<uint8_t>, FileError>
+      FileReader::readParallel(const std::filesystem::path &filePath,
+                               const ParallelReadOptions &options) const {
+#ifndef _WIN32
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+    if (!S_ISREG(info.st_mode) || info.st_size == 0) {
+      // Pipes and devices cannot be read at offsets, procfs files report no size
+      return readBytes(filePath);
+    }
+
+    IoThreadPool &pool = options.pool != nullptr ? *options.pool : IoThreadPool::shared();
+    const auto size = static_cast<std::uintmax_t>(info.st_size);
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(size));
+    std::atomic<bool> truncated{false};
+
+    const int error =
+        runRanges(pool, splitRanges(size, options, pool.size()), [&](const ByteRange &range) {
+          const ssize_t received = preadFully(fd.get(), buffer.data() + range.offset,
+                                              range.length, static_cast<off_t>(range.offset));
+          if (received < 0) {
+            return errno;
+          }
+          if (static_cast<std::size_t>(received) < range.length) {
+            truncated = true;
+          }
+          return 0;
+        });
+
+    if (error != 0) {
+      return fileErrorFromErrno(error, FileErrorCode::ReadError, "I/O error while reading file",
+                                filePath);
+    }
+    if (truncated) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "File was truncated while reading",
+          .path = filePath.string(),
+      };
+    }
+    dropIfLarge(fd.get(), size, options_.dropCacheThreshold);
     return buffer;
+#else
+    (void)options;
+    return readBytes(filePath);
+#endif
+  }
+
+  Result<std::uintmax_t, FileError>
+      FileReader::readRangesParallel(const std::filesystem::path &filePath,
+                                     const RangeCallback &callback,
+                                     const ParallelReadOptions &options) const {
+#ifndef _WIN32
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+
+    const std::size_t chunkSize = std::max<std::size_t>(options.chunkSize, 1);
+    if (!S_ISREG(info.st_mode) || info.st_size == 0) {
+      // Pipes and devices cannot be read at offsets, procfs files report no size: a single
+      // sequential range
+      fd.reset();
+      std::uintmax_t offset = 0;
+      return readChunks(
+          filePath,
+          [&](std::span<const std::byte> chunk) {
+            const bool proceed = callback(offset, chunk);
+            offset += chunk.size();
+            return proceed;
+          },
+          ReadChunkOptions{.chunkSize = chunkSize, .readAhead = false});
+    }
+
+    IoThreadPool &pool = options.pool != nullptr ? *options.pool : IoThreadPool::shared();
+    const auto size = static_cast<std::uintmax_t>(info.st_size);
+    std::atomic<bool> stopped{false};
+    std::atomic<std::uintmax_t> total{0};
+
+    const int error =
+        runRanges(pool, splitRanges(size, options, pool.size()), [&](const ByteRange &range) {
+          std::vector<std::byte> piece(std::min(chunkSize, range.length));
+          for (std::size_t done = 0; done < range.length && !stopped;) {
+            const std::size_t length = std::min(piece.size(), range.length - done);
+            const std::uintmax_t offset = range.offset + done;
+            const ssize_t received =
+                preadFully(fd.get(), piece.data(), length, static_cast<off_t>(offset));
+            if (received < 0) {
+              stopped = true;
+              return errno;
+            }
+            if (received == 0) {
+              break;
+            }
+            const auto count = static_cast<std::size_t>(received);
+            total += count;
+            try {
+              if (!callback(offset, std::span<const std::byte>(piece.data(), count))) {
+                stopped = true;
+              }
+            } catch (...) {
+              stopped = true; // Let the other ranges finish early, then rethrow
+              throw;
+            }
+            done += count;
+          }
+          return 0;
+        });
+
+    if (error != 0) {
+      return fileErrorFromErrno(error, FileErrorCode::ReadError, "I/O error while reading file",
+                                filePath);
+    }
+    return total.load();
+#else
+    std::uintmax_t offset = 0;
+    return readChunks(
+        filePath,
+        [&](std::span<const std::byte> chunk) {
+          const bool proceed = callback(offset, chunk);
+          offset += chunk.size();
+          return proceed;
+        },
+        ReadChunkOptions{.chunkSize = std::max<std::size_t>(options.chunkSize, 1)});
+#endif
+  }
+
+  std::vector<std::future<Result<std::string, FileError>>>
+      FileReader::readAsync(const std::vector<std::filesystem::path> &filePaths,
+                            IoThreadPool *pool) const {
+    IoThreadPool &workers = pool != nullptr ? *pool : IoThreadPool::shared();
+    std::vector<std::future<Result<std::string, FileError>>> results;
+    results.reserve(filePaths.size());
+    // The tasks use their own instance with the same options and never reference this one
+    for (const auto &filePath : filePaths) {
+      results.push_back(workers.submit(
+          [filePath, options = options_] { return FileReader(options).read(filePath); }));
+    }
+    return results;
+  }
+
+  std::future<void> FileReader::readAsync(const std::vector<std::filesystem::path> &filePaths,
+                                          ReadCompletion onComplete, IoThreadPool *pool) const {
+    struct Batch {
+      ReadCompletion onComplete;
+      std::atomic<std::size_t> remaining;
+      std::promise<void> done;
+      std::mutex errorMutex;
+      std::exception_ptr error;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->onComplete = std::move(onComplete);
+    batch->remaining = filePaths.size();
+    auto finished = batch->done.get_future();
+    if (filePaths.empty()) {
+      batch->done.set_value();
+      return finished;
+    }
+
+    IoThreadPool &workers = pool != nullptr ? *pool : IoThreadPool::shared();
+    for (const auto &filePath : filePaths) {
+      workers.post([batch, filePath, options = options_] {
+        try {
+          batch->onComplete(filePath, FileReader(options).read(filePath));
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(batch->errorMutex);
+          if (!batch->error) {
+            batch->error = std::current_exception();
+          }
+        }
+        if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          if (batch->error) {
+            batch->done.set_exception(batch->error);
+          } else {
+            batch->done.set_value();
+          }
+        }
+      });
+    }
+    return finished;
+  }
+
+  Result<ChecksummedContent, FileError>
+      FileReader::readWithChecksum(const std::filesystem::path &filePath,
+                                   ChecksumAlgorithm algorithm) const {
+    if (auto error = validatePath(filePath)) {
+      return *error;
+    }
+    ChecksummedContent result;
+    Checksum checksum(algorithm);
+
+#ifndef _WIN32
+    FileDescriptor fd;
+    struct stat info {};
+    if (auto error = openForReading(filePath, fd, info)) {
+      return *error;
+    }
+    if (S_ISREG(info.st_mode) && info.st_size > 0) {
+      // Pieces small enough to still be in the CPU cache when they are hashed
+      constexpr std::size_t kPieceSize = 128 * 1024;
+      int readError = 0;
+      auto readAndHash = [&](char *data, std::size_t count) {
+        std::size_t done = 0;
+        while (done < count) {
+          const std::size_t piece = std::min(kPieceSize, count - done);
+          const ssize_t received = readFully(fd.get(), data + done, piece);
+          if (received < 0) {
+            readError = errno;
+            break;
+          }
+          checksum.update(std::string_view(data + done, static_cast<std::size_t>(received)));
+          done += static_cast<std::size_t>(received);
+          if (static_cast<std::size_t>(received) < piece) {
+            break;
+          }
+        }
+        return done;
+      };
+
+      const auto size = static_cast<std::size_t>(info.st_size);
+#if defined(__cpp_lib_string_resize_and_overwrite)
+      result.content.resize_and_overwrite(size, readAndHash);
+#else
+      // C++20 zero-fills the string once before the read; only C++23 avoids that pass
+      result.content.resize(size);
+      result.content.resize(readAndHash(result.content.data(), size));
+#endif
+      if (readError != 0) {
+        return fileErrorFromErrno(readError, FileErrorCode::ReadError,
+                                  "I/O error while reading file", filePath);
+      }
+      dropIfLarge(fd.get(), size, options_.dropCacheThreshold);
+      result.checksum = checksum.digest();
+      return result;
+    }
+    fd.reset();
+#endif
+
+    // Size not known up front: hash the chunks as they arrive
+    auto streamed = readChunks(filePath, [&](std::span<const std::byte> chunk) {
+      result.content.append(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+      checksum.update(chunk);
+      return true;
+    });
+    if (!streamed) {
+      return streamed.error();
+    }
+    result.checksum = checksum.digest();
+    return result;
+  }
+
+  Result<std::uint64_t, FileError> FileReader::hashFile(const std::filesystem::path &filePath,
+                                                        ChecksumAlgorithm algorithm,
+                                                        const ReadChunkOptions &options) const {
+    Checksum checksum(algorithm);
+    auto streamed = readChunks(
+        filePath,
+        [&checksum](std::span<const std::byte> chunk) {
+          checksum.update(chunk);
+          return true;
+        },
+        options);
+    if (!streamed) {
+      return streamed.error();
+    }
+    return checksum.digest();
+  }
+
+  std::future<void> FileReader::prefetch(const std::vector<std::filesystem::path> &filePaths,
+                                         IoThreadPool *pool) const {
+    struct Batch {
+      std::atomic<std::size_t> remaining;
+      std::promise<void> done;
+    };
+    auto batch = std::make_shared<Batch>();
+    batch->remaining = filePaths.size();
+    auto finished = batch->done.get_future();
+    if (filePaths.empty()) {
+      batch->done.set_value();
+      return finished;
+    }
+
+    IoThreadPool &workers = pool != nullptr ? *pool : IoThreadPool::shared();
+    for (const auto &filePath : filePaths) {
+      workers.post([batch, filePath] {
+        prefetchFile(filePath);
+        if (batch->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+          batch->done.set_value();
+        }
+      });
+    }
+    return finished;
   }
 
   Result<std::vector<std::string>, FileError>
@@ -77,6 +1006,25 @@ namespace dotnamecpp::utils {
       return *error;
     }
 
+#ifndef _WIN32
+    std::string content;
+    if (auto error = readWholeFile(filePath, content, options_.dropCacheThreshold)) {
+      return *error;
+    }
+
+    // Same splitting as std::getline: no empty entry after a trailing newline
+    std::vector<std::string> lines;
+    std::size_t begin = 0;
+    while (begin < content.size()) {
+      std::size_t end = content.find('\n', begin);
+      if (end == std::string::npos) {
+        end = content.size();
+      }
+      lines.emplace_back(content, begin, end - begin);
+      begin = end + 1;
+    }
+    return lines;
+#else
     std::ifstream file(filePath, std::ios::in);
     if (!file.is_open()) {
       return FileError{
@@ -102,6 +1050,7 @@ namespace dotnamecpp::utils {
     }
 
     return lines;
+#endif
   }
 
   bool FileReader::exists(const std::filesystem::path &filePath) const {
@@ -115,6 +1064,21 @@ namespace dotnamecpp::utils {
       return *error;
     }
 
+#ifndef _WIN32
+    struct stat info {};
+    if (::stat(filePath.c_str(), &info) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "Failed to get file size",
+                                filePath);
+    }
+    if (S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+    return static_cast<std::uintmax_t>(info.st_size);
+#else
     std::error_code ec;
     auto size = std::filesystem::file_size(filePath, ec);
 
@@ -127,6 +1091,7 @@ namespace dotnamecpp::utils {
     }
 
     return size;
+#endif
   }
 
   std::optional<FileError> FileReader::validatePath(const std::filesystem::path &filePath) {
@@ -138,6 +1103,12 @@ namespace dotnamecpp::utils {
       };
     }
 
+#ifndef _WIN32
+    // Existence, access and file type are checked on the opened descriptor (or by a single
+    // stat in getSize), which avoids extra metadata syscalls and the window between check and
+    // open
+    return std::nullopt;
+#else
     std::error_code ec;
 
     if (!std::filesystem::exists(filePath, ec) || ec) {
@@ -160,6 +1131,7 @@ namespace dotnamecpp::utils {
     // For now, we rely on open() to report AccessDenied errors
 
     return std::nullopt;
+#endif
   }
 
 } // namespace dotnamecpp::utils
\ No newline at end of file
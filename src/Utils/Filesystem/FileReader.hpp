@@ -4,9 +4,19 @@
 
 namespace dotnamecpp::utils {
 
+  /**
+   * @brief Configuration of FileReader
+   *
+   */
+  struct FileReaderOptions {
+    // Whole-file reads of at least this many bytes drop the file from the page cache
+    // afterwards, keeping large one-off inputs from evicting the hot working set; 0 disables
+    std::uintmax_t dropCacheThreshold = 0;
+  };
+
   class FileReader final : public IFileReader {
   public:
-    FileReader() = default;
+    explicit FileReader(FileReaderOptions options = {}) : options_(options) {}
     FileReader(const FileReader &) = delete;
     FileReader &operator=(const FileReader &) = delete;
     FileReader(FileReader &&) = delete;
@@ -20,10 +30,74 @@ namespace dotnamecpp::utils {
     Result<std::vector<uint8_t>, FileError>
         readBytes(const std::filesystem::path &filePath) const override;
 
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::span<std::byte> buffer) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                            std::pmr::string &buffer) const override;
+
+    [[nodiscard]]
+    Result<BufferPool::Buffer, FileError> readPooled(const std::filesystem::path &filePath,
+                                                     BufferPool &pool) const override;
+
+    [[nodiscard]]
+    Result<MappedFile, FileError> readMapped(const std::filesystem::path &filePath,
+                                             const ReadHints &hints = {}) const override;
+
     [[nodiscard]]
     Result<std::vector<std::string>, FileError>
         readLines(const std::filesystem::path &filePath) const override;
 
+    [[nodiscard]]
+    Result<LineView, FileError>
+        readLineView(const std::filesystem::path &filePath) const override;
+
+    [[nodiscard]]
+    Result<std::size_t, FileError> forEachLine(const std::filesystem::path &filePath,
+                                               const LineCallback &callback,
+                                               std::size_t chunkSize = kDefaultChunkSize)
+        const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError> readChunks(const std::filesystem::path &filePath,
+                                                 const ChunkCallback &callback,
+                                                 const ReadChunkOptions &options = {})
+        const override;
+
+    [[nodiscard]]
+    Result<std::vector<uint8_t>, FileError>
+        readParallel(const std::filesystem::path &filePath,
+                     const ParallelReadOptions &options = {}) const override;
+
+    [[nodiscard]]
+    Result<std::uintmax_t, FileError>
+        readRangesParallel(const std::filesystem::path &filePath, const RangeCallback &callback,
+                           const ParallelReadOptions &options = {}) const override;
+
+    [[nodiscard]]
+    std::vector<std::future<Result<std::string, FileError>>>
+        readAsync(const std::vector<std::filesystem::path> &filePaths,
+                  IoThreadPool *pool = nullptr) const override;
+
+    std::future<void> readAsync(const std::vector<std::filesystem::path> &filePaths,
+                                ReadCompletion onComplete,
+                                IoThreadPool *pool = nullptr) const override;
+
+    [[nodiscard]]
+    Result<ChecksummedContent, FileError>
+        readWithChecksum(const std::filesystem::path &filePath,
+                         ChecksumAlgorithm algorithm) const override;
+
+    [[nodiscard]]
+    Result<std::uint64_t, FileError> hashFile(const std::filesystem::path &filePath,
+                                              ChecksumAlgorithm algorithm,
+                                              const ReadChunkOptions &options = {}) const override;
+
+    std::future<void> prefetch(const std::vector<std::filesystem::path> &filePaths,
+                               IoThreadPool *pool = nullptr) const override;
+
     [[nodiscard]]
     bool exists(const std::filesystem::path &filePath) const override;
 
@@ -33,6 +107,8 @@ namespace dotnamecpp::utils {
   private:
     [[nodiscard]]
     static std::optional<FileError> validatePath(const std::filesystem::path &filePath);
+
+    FileReaderOptions options_;
   };
 
 } // namespace dotnamecpp::utils
\ No newline at end of file
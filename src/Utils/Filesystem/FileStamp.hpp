@@ -0,0 +1,74 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <system_error>
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Identity and version of a regular file
+   *
+   * Two stamps of the same path compare equal only if the file was neither replaced (device,
+   * inode) nor modified (size, modification time in ns) in between.
+   */
+  struct FileStamp {
+    std::uint64_t device = 0;
+    std::uint64_t inode = 0;
+    std::uintmax_t size = 0;
+    std::int64_t mtimeNs = 0;
+
+    bool operator==(const FileStamp &other) const = default;
+  };
+
+  /**
+   * @brief Take the stamp of a regular file with a single stat()
+   *
+   * @param filePath
+   * @return std::optional<FileStamp>, empty if the path is missing or not a regular file
+   */
+  inline std::optional<FileStamp> statFileStamp(const std::filesystem::path &filePath) {
+    if (filePath.empty()) {
+      return std::nullopt;
+    }
+#ifndef _WIN32
+    struct stat info {};
+    if (::stat(filePath.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) {
+      return std::nullopt;
+    }
+#ifdef __APPLE__
+    const auto &mtime = info.st_mtimespec;
+#else
+    const auto &mtime = info.st_mtim;
+#endif
+    return FileStamp{
+        .device = static_cast<std::uint64_t>(info.st_dev),
+        .inode = static_cast<std::uint64_t>(info.st_ino),
+        .size = static_cast<std::uintmax_t>(info.st_size),
+        .mtimeNs = static_cast<std::int64_t>(mtime.tv_sec) * 1000000000 + mtime.tv_nsec,
+    };
+#else
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(filePath, ec)) {
+      return std::nullopt;
+    }
+    const auto size = std::filesystem::file_size(filePath, ec);
+    const auto mtime = std::filesystem::last_write_time(filePath, ec);
+    if (ec) {
+      return std::nullopt;
+    }
+    return FileStamp{
+        .size = size,
+        .mtimeNs = std::chrono::duration_cast<std::chrono::nanoseconds>(mtime.time_since_epoch())
+                       .count(),
+    };
+#endif
+  }
+
+} // namespace dotnamecpp::utils
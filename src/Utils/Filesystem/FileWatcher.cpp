@@ -0,0 +1,310 @@
+#include "FileWatcher.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <system_error>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#endif
+
+#ifndef _WIN32
+#include <sys/stat.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+#ifdef __linux__
+  namespace {
+    // Events on a file inside a watched directory that may change its content or identity
+    constexpr std::uint32_t kDirectoryMask = IN_MODIFY | IN_ATTRIB | IN_CLOSE_WRITE | IN_CREATE |
+                                             IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO |
+                                             IN_DELETE_SELF | IN_MOVE_SELF | IN_ONLYDIR;
+  } // namespace
+#endif
+
+  FileWatcher::FileWatcher(FileWatcherOptions options) : options_(options) {
+#ifdef __linux__
+    if (!options_.forcePolling) {
+      inotify_.reset(::inotify_init1(IN_NONBLOCK | IN_CLOEXEC));
+      int pipeFds[2] = {-1, -1};
+      if (inotify_ && ::pipe2(pipeFds, O_CLOEXEC) == 0) {
+        wakeRead_.reset(pipeFds[0]);
+        wakeWrite_.reset(pipeFds[1]);
+        thread_ = std::thread(&FileWatcher::inotifyLoop, this);
+        return;
+      }
+      inotify_.reset();
+    }
+#endif
+    thread_ = std::thread(&FileWatcher::pollLoop, this);
+  }
+
+  FileWatcher::~FileWatcher() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    stopCv_.notify_all();
+#ifdef __linux__
+    if (wakeWrite_) {
+      const char wake = 0;
+      [[maybe_unused]] const auto written = ::write(wakeWrite_.get(), &wake, 1);
+    }
+#endif
+    thread_.join();
+  }
+
+  FileWatcher::ListenerId FileWatcher::addListener(Listener listener) {
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+    const ListenerId id = nextListenerId_++;
+    listeners_.emplace_back(id, std::move(listener));
+    return id;
+  }
+
+  void FileWatcher::removeListener(ListenerId id) {
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+    std::erase_if(listeners_, [id](const auto &entry) { return entry.first == id; });
+  }
+
+  bool FileWatcher::watch(const std::filesystem::path &filePath) {
+    if (filePath.empty()) {
+      return false;
+    }
+    const auto path = normalize(filePath);
+#ifndef _WIN32
+    struct stat info {};
+    if (::lstat(path.c_str(), &info) != 0 || !S_ISREG(info.st_mode)) {
+      return false;
+    }
+#else
+    std::error_code ec;
+    if (!std::filesystem::is_regular_file(std::filesystem::symlink_status(path, ec))) {
+      return false;
+    }
+#endif
+    const auto stamp = usesInotify() ? std::nullopt : statFileStamp(path);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [it, inserted] = files_.try_emplace(path.string());
+    if (!inserted && !it->second.detached) {
+      ++it->second.refs;
+      return true;
+    }
+
+#ifdef __linux__
+    // A new file, or one whose directory watch was lost and is set up again
+    if (inotify_) {
+      const auto directory = path.parent_path();
+      auto dir = directories_.find(directory.string());
+      if (dir == directories_.end()) {
+        const int wd = ::inotify_add_watch(inotify_.get(), directory.c_str(), kDirectoryMask);
+        if (wd < 0) {
+          if (inserted) {
+            files_.erase(it);
+          }
+          return false;
+        }
+        dir = directories_.emplace(directory.string(), DirectoryWatch{.wd = wd}).first;
+        directoryByWd_[wd] = directory;
+      }
+      ++dir->second.files;
+    }
+#endif
+    ++it->second.refs;
+    it->second.stamp = stamp;
+    it->second.detached = false;
+    return true;
+  }
+
+  void FileWatcher::unwatch(const std::filesystem::path &filePath) {
+    const auto path = normalize(filePath);
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = files_.find(path.string());
+    if (it == files_.end() || --it->second.refs > 0) {
+      return;
+    }
+    const bool detached = it->second.detached;
+    files_.erase(it);
+
+#ifdef __linux__
+    if (inotify_ && !detached) {
+      auto dir = directories_.find(path.parent_path().string());
+      if (dir != directories_.end() && --dir->second.files == 0) {
+        ::inotify_rm_watch(inotify_.get(), dir->second.wd);
+        directoryByWd_.erase(dir->second.wd);
+        directories_.erase(dir);
+      }
+    }
+#endif
+  }
+
+  bool FileWatcher::isWatching(const std::filesystem::path &filePath) const {
+    const auto key = normalize(filePath).string();
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = files_.find(key);
+    return it != files_.end() && !it->second.detached;
+  }
+
+  std::size_t FileWatcher::watchedCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return static_cast<std::size_t>(std::count_if(
+        files_.begin(), files_.end(), [](const auto &entry) { return !entry.second.detached; }));
+  }
+
+  bool FileWatcher::usesInotify() const noexcept {
+#ifdef __linux__
+    return static_cast<bool>(inotify_);
+#else
+    return false;
+#endif
+  }
+
+  std::filesystem::path FileWatcher::normalize(const std::filesystem::path &filePath) {
+    // Deliberately not canonical(): resolving symlinks costs a syscall per path component
+    std::error_code ec;
+    const auto absolute = std::filesystem::absolute(filePath, ec);
+    return (ec ? filePath : absolute).lexically_normal();
+  }
+
+  void FileWatcher::notify(const std::vector<std::filesystem::path> &changed) {
+    if (changed.empty()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(listenersMutex_);
+    for (const auto &path : changed) {
+      for (const auto &[id, listener] : listeners_) {
+        listener(path);
+      }
+    }
+  }
+
+  void FileWatcher::pollLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopCv_.wait_for(lock, options_.pollInterval, [this] { return stopping_; })) {
+      std::vector<std::string> paths;
+      paths.reserve(files_.size());
+      for (const auto &[path, file] : files_) {
+        paths.push_back(path);
+      }
+
+      // stat() without holding the lock, watch() and unwatch() must not wait for the disk
+      lock.unlock();
+      std::vector<std::optional<FileStamp>> stamps;
+      stamps.reserve(paths.size());
+      for (const auto &path : paths) {
+        stamps.push_back(statFileStamp(path));
+      }
+      lock.lock();
+
+      std::vector<std::filesystem::path> changed;
+      for (std::size_t i = 0; i < paths.size(); ++i) {
+        auto it = files_.find(paths[i]);
+        if (it != files_.end() && it->second.stamp != stamps[i]) {
+          it->second.stamp = stamps[i];
+          changed.emplace_back(paths[i]);
+        }
+      }
+
+      lock.unlock();
+      notify(changed);
+      lock.lock();
+    }
+  }
+
+#ifdef __linux__
+  void FileWatcher::inotifyLoop() {
+    alignas(struct inotify_event) char buffer[16 * 1024];
+    std::vector<std::filesystem::path> changed;
+
+    std::array<pollfd, 2> fds{{{.fd = inotify_.get(), .events = POLLIN, .revents = 0},
+                               {.fd = wakeRead_.get(), .events = POLLIN, .revents = 0}}};
+    for (;;) {
+      if (::poll(fds.data(), fds.size(), -1) < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return;
+      }
+      if (fds[1].revents != 0) {
+        return;
+      }
+
+      for (;;) {
+        const ssize_t length = ::read(inotify_.get(), buffer, sizeof(buffer));
+        if (length <= 0) {
+          break; // EAGAIN: queue drained
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        handleEvents(buffer, static_cast<std::size_t>(length), changed);
+      }
+
+      std::sort(changed.begin(), changed.end());
+      changed.erase(std::unique(changed.begin(), changed.end()), changed.end());
+      notify(changed);
+      changed.clear();
+    }
+  }
+
+  void FileWatcher::handleEvents(const char *buffer, std::size_t length,
+                                 std::vector<std::filesystem::path> &changed) {
+    for (std::size_t offset = 0; offset < length;) {
+      const auto *event = reinterpret_cast<const struct inotify_event *>(buffer + offset);
+      offset += sizeof(struct inotify_event) + event->len;
+
+      if ((event->mask & IN_Q_OVERFLOW) != 0) {
+        // Events were lost, every watched file may have changed
+        for (const auto &[path, file] : files_) {
+          if (!file.detached) {
+            changed.emplace_back(path);
+          }
+        }
+        continue;
+      }
+
+      const auto dir = directoryByWd_.find(event->wd);
+      if (dir == directoryByWd_.end()) {
+        continue; // Late event of a removed watch
+      }
+      const std::filesystem::path directory = dir->second;
+
+      if ((event->mask & (IN_IGNORED | IN_DELETE_SELF | IN_MOVE_SELF | IN_UNMOUNT)) != 0) {
+        // The directory is gone or moved: its files can no longer be watched by this path
+        forgetDirectory(directory, (event->mask & IN_IGNORED) == 0, changed);
+        continue;
+      }
+
+      if (event->len > 0) {
+        auto path = directory / event->name;
+        if (const auto it = files_.find(path.string());
+            it != files_.end() && !it->second.detached) {
+          changed.push_back(std::move(path));
+        }
+      }
+    }
+  }
+
+  void FileWatcher::forgetDirectory(const std::filesystem::path &directory, bool removeWatch,
+                                    std::vector<std::filesystem::path> &changed) {
+    // Entries stay until their last unwatch(), so the reference counts remain balanced
+    for (auto &[key, file] : files_) {
+      std::filesystem::path path(key);
+      if (!file.detached && path.parent_path() == directory) {
+        file.detached = true;
+        changed.push_back(std::move(path));
+      }
+    }
+
+    auto dir = directories_.find(directory.string());
+    if (dir != directories_.end()) {
+      if (removeWatch) {
+        ::inotify_rm_watch(inotify_.get(), dir->second.wd);
+      }
+      directoryByWd_.erase(dir->second.wd);
+      directories_.erase(dir);
+    }
+  }
+#endif
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <Utils/Filesystem/FileStamp.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <Utils/Filesystem/FileDescriptor.hpp>
+#endif
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Configuration of FileWatcher
+   *
+   */
+  struct FileWatcherOptions {
+    std::chrono::milliseconds pollInterval{500}; // Used when inotify is unavailable
+    bool forcePolling = false;                   // Poll even where inotify is available
+  };
+
+  /**
+   * @brief Background service reporting changes of individual files to listeners
+   *
+   * On Linux the parent directory of every watched file is watched with inotify, so a file
+   * being modified, touched, deleted, or replaced by a rename is reported within milliseconds.
+   * Elsewhere, when inotify cannot be initialised, or when forced, a thread stats every watched
+   * file once per poll interval instead.
+   *
+   * Watches are reference counted: every successful watch() must be balanced by an unwatch().
+   * When a watched file's directory is removed or moved, its files are reported as changed
+   * and stop being watched, but their references are kept until the matching unwatch() calls.
+   * Listeners run on the watcher thread with the listener list locked, so a listener must not
+   * add or remove listeners itself.
+   */
+  class FileWatcher final {
+  public:
+    using Listener = std::function<void(const std::filesystem::path &)>;
+    using ListenerId = std::uint64_t;
+
+    explicit FileWatcher(FileWatcherOptions options = {});
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher &) = delete;
+    FileWatcher &operator=(const FileWatcher &) = delete;
+    FileWatcher(FileWatcher &&) = delete;
+    FileWatcher &operator=(FileWatcher &&) = delete;
+
+    /**
+     * @brief Register a listener called with the normalized path of every changed file
+     *
+     * @param listener
+     * @return ListenerId for removeListener()
+     */
+    ListenerId addListener(Listener listener);
+
+    /**
+     * @brief Unregister a listener; when this returns the listener is no longer running
+     *
+     * @param id
+     */
+    void removeListener(ListenerId id);
+
+    /**
+     * @brief Start watching a regular file, or add a reference to an existing watch
+     *
+     * Symbolic links are rejected because changes of their target would go unnoticed.
+     *
+     * @param filePath
+     * @return true if the file is watched
+     */
+    [[nodiscard]]
+    bool watch(const std::filesystem::path &filePath);
+
+    /**
+     * @brief Drop one reference to a watch, stopping it with the last one
+     *
+     * @param filePath
+     */
+    void unwatch(const std::filesystem::path &filePath);
+
+    [[nodiscard]]
+    bool isWatching(const std::filesystem::path &filePath) const;
+
+    /**
+     * @brief Number of distinct files watched
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t watchedCount() const;
+
+    /**
+     * @brief Whether changes are delivered by inotify rather than by polling
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    bool usesInotify() const noexcept;
+
+    /**
+     * @brief Absolute, lexically normal form under which paths are watched and reported
+     *
+     * @param filePath
+     * @return std::filesystem::path
+     */
+    [[nodiscard]]
+    static std::filesystem::path normalize(const std::filesystem::path &filePath);
+
+  private:
+    struct WatchedFile {
+      std::size_t refs = 0;
+      std::optional<FileStamp> stamp; // Last seen version, polling only
+      bool detached = false;          // Its directory watch is gone, inotify only
+    };
+
+    void pollLoop();
+    void notify(const std::vector<std::filesystem::path> &changed);
+
+#ifdef __linux__
+    struct DirectoryWatch {
+      int wd = -1;
+      std::size_t files = 0;
+    };
+
+    void inotifyLoop();
+    void handleEvents(const char *buffer, std::size_t length,
+                      std::vector<std::filesystem::path> &changed);
+    void forgetDirectory(const std::filesystem::path &directory, bool removeWatch,
+                         std::vector<std::filesystem::path> &changed);
+
+    FileDescriptor inotify_;
+    FileDescriptor wakeRead_;
+    FileDescriptor wakeWrite_;
+    std::unordered_map<std::string, DirectoryWatch> directories_;
+    std::unordered_map<int, std::filesystem::path> directoryByWd_;
+#endif
+
+    FileWatcherOptions options_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable stopCv_;
+    bool stopping_ = false;
+    std::unordered_map<std::string, WatchedFile> files_;
+
+    std::mutex listenersMutex_;
+    std::vector<std::pair<ListenerId, Listener>> listeners_;
+    ListenerId nextListenerId_ = 1;
+
+    std::thread thread_;
+  };
+
+} // namespace dotnamecpp::utils
@@ -1,20 +1,390 @@
 #include "FileWriter.hpp"
+#include "DirectoryCache.hpp"
+#include "FileAppender.hpp"
+#include "FileDescriptor.hpp"
+#include "GroupCommit.hpp"
+#include <algorithm>
+#include <atomic>
+#include <climits>
+#include <cstring>
 #include <fmt/core.h>
 #include <fstream>
 #include <system_error>
 
+#ifndef _WIN32
+#include <sys/stat.h>
+#include <sys/uio.h>
+#endif
+
 namespace dotnamecpp::utils {
 
+  namespace {
+
+    // Create the missing parent directories of a file, remembering them in DirectoryCache
+    std::optional<FileError> createParentDirectories(const std::filesystem::path &filePath) {
+      auto parent = filePath.parent_path();
+      if (parent.empty()) {
+        return std::nullopt; // No parent to create
+      }
+
+      auto &cache = DirectoryCache::shared();
+      if (cache.contains(parent)) {
+        return std::nullopt; // Parent already known to exist
+      }
+
+      // A single stat() when the directory already exists
+      std::error_code ec;
+      std::filesystem::create_directories(parent, ec);
+      if (ec) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = fmt::format("Failed to create parent directory: {}", ec.message()),
+            .path = parent.string(),
+        };
+      }
+
+      cache.insert(parent);
+      return std::nullopt;
+    }
+
+    // Run an operation creating filePath. Missing parent directories are created only once
+    // it reports filePath itself not found, and the operation is then retried once.
+    template <typename Operation>
+    auto createWithParents(const std::filesystem::path &filePath, Operation &&operation) {
+      auto result = operation();
+      if (!result && result.error().code == FileErrorCode::NotFound &&
+          result.error().path == filePath.string() && filePath.has_parent_path()) {
+        // The cache may still list a directory removed behind our back
+        DirectoryCache::shared().invalidate(filePath.parent_path());
+        if (auto error = createParentDirectories(filePath)) {
+          return decltype(result)(*error);
+        }
+        result = operation();
+      }
+      return result;
+    }
+
+#ifndef _WIN32
+
+    // Open a file for writing. Missing parent directories are created only once open()
+    // reports them missing, so a write into an existing directory costs the open() alone.
+    Result<FileDescriptor, FileError> openForWriting(const std::filesystem::path &filePath,
+                                                     int flags, mode_t mode = 0644) {
+      auto fd = FileDescriptor::open(filePath, flags, mode);
+      if (!fd && errno == ENOENT && (flags & O_CREAT) != 0 && filePath.has_parent_path()) {
+        // The cache may still list a directory removed behind our back
+        DirectoryCache::shared().invalidate(filePath.parent_path());
+        if (auto error = createParentDirectories(filePath)) {
+          return *error;
+        }
+        fd = FileDescriptor::open(filePath, flags, mode);
+      }
+      if (!fd) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "Failed to open file for writing", filePath);
+      }
+      return fd;
+    }
+
+    std::optional<FileError> writeWhole(const std::filesystem::path &filePath, const void *data,
+                                        std::size_t size, bool append) {
+      auto fd = openForWriting(filePath, O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC));
+      if (!fd) {
+        return fd.error();
+      }
+      if (writeFully(fd.value().get(), data, size) != size) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "I/O error while writing file", filePath);
+      }
+      return std::nullopt;
+    }
+
+#endif // _WIN32
+
+    // Concatenate lines, each followed by a newline, into one buffer of totalSize bytes
+    template <typename Lines>
+    std::string joinLines(const Lines &lines, std::size_t totalSize) {
+      std::string joined;
+      joined.reserve(totalSize);
+      for (const auto &line : lines) {
+        joined.append(line);
+        joined.push_back('\n');
+      }
+      return joined;
+    }
+
+#ifndef _WIN32
+
+#ifdef IOV_MAX
+    constexpr std::size_t kIovMax = IOV_MAX;
+#else
+    constexpr std::size_t kIovMax = 1024;
+#endif
+
+    // Up to this size lines are joined and written with one call; larger outputs are
+    // gathered with writev straight from the caller's strings instead of being copied
+    constexpr std::size_t kJoinLimit = 256 * 1024;
+
+    // writev all entries in batches of kIovMax, retrying on EINTR and short writes
+    bool writevFully(int fd, iovec *entries, std::size_t count) {
+      while (count > 0) {
+        const auto batch = static_cast<int>(std::min(count, kIovMax));
+        ssize_t written = ::writev(fd, entries, batch);
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          return false;
+        }
+        while (count > 0 && static_cast<std::size_t>(written) >= entries->iov_len) {
+          written -= static_cast<ssize_t>(entries->iov_len);
+          ++entries;
+          --count;
+        }
+        if (written > 0) {
+          entries->iov_base = static_cast<char *>(entries->iov_base) + written;
+          entries->iov_len -= static_cast<std::size_t>(written);
+        }
+      }
+      return true;
+    }
+
+    // Reserve a byte range ahead of the writes; a file system without support is no error,
+    // running out of space is
+    std::optional<FileError> preallocate(int fd, off_t offset, std::size_t length,
+                                         [[maybe_unused]] bool appending,
+                                         const std::filesystem::path &filePath) {
+      if (length == 0) {
+        return std::nullopt;
+      }
+#if defined(__linux__)
+      // KEEP_SIZE: a failed write leaves no zero-filled tail behind
+      int result = 0;
+      do {
+        result = ::fallocate(fd, FALLOC_FL_KEEP_SIZE, offset, static_cast<off_t>(length)) == 0
+                     ? 0
+                     : errno;
+      } while (result == EINTR);
+#elif !defined(__APPLE__)
+      // Extends the file size, which would move O_APPEND writes behind the reserved range
+      const int result = appending ? 0 : ::posix_fallocate(fd, offset, static_cast<off_t>(length));
+#else
+      const int result = 0;
+#endif
+      if (result == ENOSPC || result == EFBIG) {
+        return fileErrorFromErrno(result, FileErrorCode::WriteError,
+                                  "Failed to preallocate file", filePath);
+      }
+      return std::nullopt;
+    }
+
+    bool isZeroBlock(const uint8_t *data, std::size_t size) {
+      return size == 0 || (data[0] == 0 && std::memcmp(data, data + 1, size - 1) == 0);
+    }
+
+    // Write data at offset, leaving all-zero blocks (aligned to file offsets) as holes
+    bool writeSparse(int fd, std::span<const uint8_t> data, off_t offset, std::size_t blockSize) {
+      blockSize = std::max<std::size_t>(blockSize, 1);
+      const auto writeRun = [&](std::size_t begin, std::size_t end) {
+        return pwriteFully(fd, data.data() + begin, end - begin,
+                           offset + static_cast<off_t>(begin)) == end - begin;
+      };
+
+      std::size_t runStart = 0;
+      bool inRun = false;
+      for (std::size_t position = 0; position < data.size();) {
+        const auto fileOffset = static_cast<std::size_t>(offset) + position;
+        const std::size_t length =
+            std::min(blockSize - fileOffset % blockSize, data.size() - position);
+        const bool zero = isZeroBlock(data.data() + position, length);
+        if (zero && inRun) {
+          if (!writeRun(runStart, position)) {
+            return false;
+          }
+          inRun = false;
+        } else if (!zero && !inRun) {
+          runStart = position;
+          inRun = true;
+        }
+        position += length;
+      }
+      if (inRun && !writeRun(runStart, data.size())) {
+        return false;
+      }
+
+      // Trailing holes still count towards the file size
+      return ::ftruncate(fd, offset + static_cast<off_t>(data.size())) == 0;
+    }
+
+    // Whether the descriptor is opened with O_APPEND: sparse writes are positional, so holes
+    // line up with file offsets, every other append stays atomic towards concurrent writers
+    bool usesAppendMode(const WriteOptions &options) {
+      return options.append && !options.sparse;
+    }
+
+    // Write data at offset (the current end of file in append mode) according to the
+    // preallocate / sparse options
+    std::optional<FileError> writeAt(int fd, std::span<const uint8_t> data, off_t offset,
+                                     const WriteOptions &options,
+                                     const std::filesystem::path &filePath) {
+      const bool appending = usesAppendMode(options);
+      if (options.preallocate && !options.sparse) {
+        if (auto error = preallocate(fd, offset, data.size(), appending, filePath)) {
+          return error;
+        }
+      }
+
+      bool written = false;
+      if (options.sparse) {
+        written = writeSparse(fd, data, offset, options.sparseBlockSize);
+      } else if (appending) {
+        written = writeFully(fd, data.data(), data.size()) == data.size();
+      } else {
+        written = pwriteFully(fd, data.data(), data.size(), offset) == data.size();
+      }
+      if (!written) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "I/O error while writing file", filePath);
+      }
+      return std::nullopt;
+    }
+
+    // Persist the directory entries of a file's parent; concurrent callers share one fsync
+    std::optional<FileError> syncParentDirectory(const std::filesystem::path &filePath) {
+      auto parent = filePath.parent_path();
+      if (parent.empty()) {
+        parent = ".";
+      }
+      const auto fd = FileDescriptor::open(parent, O_RDONLY | O_DIRECTORY);
+      if (!fd) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "Failed to open directory for syncing", parent);
+      }
+      if (const int error = GroupCommit::shared().sync(fd.get(), true)) {
+        return fileErrorFromErrno(error, FileErrorCode::WriteError, "Failed to sync directory",
+                                  parent);
+      }
+      return std::nullopt;
+    }
+
+    // Write the complete new content to a temporary file next to the target, sync it and
+    // rename it into place, so that after a crash the path holds either the old or the new
+    // content, never a mix
+    std::optional<FileError> replaceDurably(const std::filesystem::path &filePath,
+                                            std::span<const uint8_t> data,
+                                            const WriteOptions &options) {
+      static std::atomic<std::uint64_t> counter{0};
+      auto temporary = filePath;
+      temporary.replace_filename(fmt::format(".{}.{}.{}.tmp", filePath.filename().string(),
+                                             ::getpid(), counter++));
+
+      struct stat existing{};
+      const bool existed = ::stat(filePath.c_str(), &existing) == 0;
+      auto opened = openForWriting(temporary, O_WRONLY | O_CREAT | O_EXCL);
+      if (!opened) {
+        return opened.error();
+      }
+      const FileDescriptor fd = std::move(opened).value();
+
+      auto error = writeAt(fd.get(), data, 0, options, temporary);
+      if (!error && existed) {
+        ::fchmod(fd.get(), existing.st_mode & 07777);
+      }
+      if (!error) {
+        int result = 0;
+        do {
+          result = ::fdatasync(fd.get()) == 0 ? 0 : errno;
+        } while (result == EINTR);
+        if (result != 0) {
+          error = fileErrorFromErrno(result, FileErrorCode::WriteError, "Failed to sync file",
+                                     temporary);
+        }
+      }
+      if (!error && ::rename(temporary.c_str(), filePath.c_str()) != 0) {
+        error = fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to replace file",
+                                   filePath);
+      }
+      if (error) {
+        ::unlink(temporary.c_str());
+        return error;
+      }
+      return syncParentDirectory(filePath);
+    }
+
+#endif // _WIN32
+
+    template <typename Lines>
+    std::optional<FileError> writeLineRange(const std::filesystem::path &filePath,
+                                            const Lines &lines, bool append) {
+      std::size_t totalSize = 0;
+      for (const auto &line : lines) {
+        totalSize += line.size() + 1;
+      }
+
+#ifndef _WIN32
+      auto opened = openForWriting(filePath, O_WRONLY | O_CREAT | (append ? O_APPEND : O_TRUNC));
+      if (!opened) {
+        return opened.error();
+      }
+      const FileDescriptor fd = std::move(opened).value();
+
+      bool written = false;
+      if (totalSize <= kJoinLimit) {
+        const std::string joined = joinLines(lines, totalSize);
+        written = writeFully(fd.get(), joined.data(), joined.size()) == joined.size();
+      } else {
+        static const char newline = '\n';
+        std::vector<iovec> entries;
+        entries.reserve(std::size(lines) * 2);
+        for (const auto &line : lines) {
+          entries.push_back({const_cast<char *>(line.data()), line.size()});
+          entries.push_back({const_cast<char *>(&newline), 1});
+        }
+        written = writevFully(fd.get(), entries.data(), entries.size());
+      }
+      if (!written) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "I/O error while writing file", filePath);
+      }
+#else
+      auto mode = append ? (std::ios::out | std::ios::app) : std::ios::out;
+      std::ofstream file(filePath, mode);
+
+      if (!file.is_open()) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "Failed to open file for writing",
+            .path = filePath.string(),
+        };
+      }
+
+      const std::string joined = joinLines(lines, totalSize);
+      file.write(joined.data(), static_cast<std::streamsize>(joined.size()));
+
+      if (file.bad()) {
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "I/O error while writing file",
+            .path = filePath.string(),
+        };
+      }
+#endif
+      return std::nullopt;
+    }
+
+  } // namespace
+
   Result<void, FileError> FileWriter::write(const std::filesystem::path &filePath,
                                             const std::string &content, bool append) const {
-    if (auto error = validatePath(filePath, false)) {
+    if (auto error = prepareTarget(filePath)) {
       return *error;
     }
 
-    if (auto error = ensureParentExists(filePath)) {
+#ifndef _WIN32
+    if (auto error = writeWhole(filePath, content.data(), content.size(), append)) {
       return *error;
     }
-
+#else
     auto mode = append ? (std::ios::out | std::ios::app) : std::ios::out;
     std::ofstream file(filePath, mode);
 
@@ -35,6 +405,7 @@ namespace dotnamecpp::utils {
           .path = filePath.string(),
       };
     }
+#endif
 
     return {}; // Success - Result<void, E> default constructs to success
   }
@@ -42,14 +413,15 @@ namespace dotnamecpp::utils {
   Result<void, FileError> FileWriter::writeBytes(const std::filesystem::path &filePath,
                                                  const std::vector<uint8_t> &data,
                                                  bool append) const {
-    if (auto error = validatePath(filePath, false)) {
+    if (auto error = prepareTarget(filePath)) {
       return *error;
     }
 
-    if (auto error = ensureParentExists(filePath)) {
+#ifndef _WIN32
+    if (auto error = writeWhole(filePath, data.data(), data.size(), append)) {
       return *error;
     }
-
+#else
     auto mode = append ? (std::ios::binary | std::ios::app) : std::ios::binary;
     std::ofstream file(filePath, mode);
 
@@ -70,53 +442,140 @@ namespace dotnamecpp::utils {
           .path = filePath.string(),
       };
     }
+#endif
 
     return {};
   }
 
-  Result<void, FileError> FileWriter::writeLines(const std::filesystem::path &filePath,
-                                                 const std::vector<std::string> &lines,
-                                                 bool append) const {
-    if (auto error = validatePath(filePath, false)) {
+  Result<void, FileError> FileWriter::writeBytes(const std::filesystem::path &filePath,
+                                                 std::span<const uint8_t> data,
+                                                 const WriteOptions &options) const {
+    if (auto error = prepareTarget(filePath)) {
       return *error;
     }
 
-    if (auto error = ensureParentExists(filePath)) {
+#ifndef _WIN32
+    if (options.durable && !options.append) {
+      if (auto error = replaceDurably(filePath, data, options)) {
+        return *error;
+      }
+      return {};
+    }
+
+    // A newly created file is only durable together with its directory entry
+    struct stat existing{};
+    const bool created = options.durable && ::stat(filePath.c_str(), &existing) != 0;
+
+    int flags = O_WRONLY | O_CREAT;
+    if (!options.append) {
+      flags |= O_TRUNC;
+    } else if (usesAppendMode(options)) {
+      flags |= O_APPEND;
+    }
+    auto opened = openForWriting(filePath, flags);
+    if (!opened) {
+      return opened.error();
+    }
+    const FileDescriptor fd = std::move(opened).value();
+
+    off_t offset = 0;
+    if (options.append && (offset = ::lseek(fd.get(), 0, SEEK_END)) < 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to seek file",
+                                filePath);
+    }
+
+    if (auto error = writeAt(fd.get(), data, offset, options, filePath)) {
       return *error;
     }
 
-    auto mode = append ? (std::ios::out | std::ios::app) : std::ios::out;
-    std::ofstream file(filePath, mode);
+    if (options.durable) {
+      if (const int error = GroupCommit::shared().sync(fd.get())) {
+        return fileErrorFromErrno(error, FileErrorCode::WriteError, "Failed to sync file",
+                                  filePath);
+      }
+      if (created) {
+        if (auto error = syncParentDirectory(filePath)) {
+          return *error;
+        }
+      }
+    }
+#else
+    // Durable replacement: write a temporary file and move it over the target
+    auto target = filePath;
+    if (options.durable && !options.append) {
+      target += ".tmp";
+    }
+
+    auto mode = options.append ? (std::ios::binary | std::ios::app) : std::ios::binary;
+    std::ofstream file(target, mode);
 
     if (!file.is_open()) {
       return FileError{
           .code = FileErrorCode::WriteError,
           .message = "Failed to open file for writing",
-          .path = filePath.string(),
+          .path = target.string(),
       };
     }
 
-    for (const auto &line : lines) {
-      file << line << '\n';
-    }
+    file.write(reinterpret_cast<const char *>(data.data()),
+               static_cast<std::streamsize>(data.size()));
+    file.close();
 
-    if (file.bad()) {
+    if (file.fail()) {
       return FileError{
           .code = FileErrorCode::WriteError,
           .message = "I/O error while writing file",
-          .path = filePath.string(),
+          .path = target.string(),
       };
     }
 
+    if (target != filePath) {
+      std::error_code ec;
+      std::filesystem::rename(target, filePath, ec);
+      if (ec) {
+        std::filesystem::remove(target, ec);
+        return FileError{
+            .code = FileErrorCode::WriteError,
+            .message = "Failed to replace file",
+            .path = filePath.string(),
+        };
+      }
+    }
+#endif
+
     return {};
   }
 
-  Result<void, FileError> FileWriter::touch(const std::filesystem::path &filePath) const {
-    if (auto error = validatePath(filePath, false)) {
+  Result<void, FileError> FileWriter::writeLines(const std::filesystem::path &filePath,
+                                                 const std::vector<std::string> &lines,
+                                                 bool append) const {
+    if (auto error = prepareTarget(filePath)) {
+      return *error;
+    }
+
+    if (auto error = writeLineRange(filePath, lines, append)) {
+      return *error;
+    }
+
+    return {};
+  }
+
+  Result<void, FileError> FileWriter::writeLines(const std::filesystem::path &filePath,
+                                                 std::span<const std::string_view> lines,
+                                                 bool append) const {
+    if (auto error = prepareTarget(filePath)) {
+      return *error;
+    }
+
+    if (auto error = writeLineRange(filePath, lines, append)) {
       return *error;
     }
 
-    if (auto error = ensureParentExists(filePath)) {
+    return {};
+  }
+
+  Result<void, FileError> FileWriter::touch(const std::filesystem::path &filePath) const {
+    if (auto error = validatePath(filePath, false)) {
       return *error;
     }
 
@@ -136,6 +595,15 @@ namespace dotnamecpp::utils {
       }
     } else {
       // Create empty file
+#ifndef _WIN32
+      auto created = openForWriting(filePath, O_WRONLY | O_CREAT);
+      if (!created) {
+        return created.error();
+      }
+#else
+      if (auto error = ensureParentExists(filePath)) {
+        return *error;
+      }
       std::ofstream file(filePath);
       if (!file.is_open()) {
         return FileError{
@@ -144,11 +612,48 @@ namespace dotnamecpp::utils {
             .path = filePath.string(),
         };
       }
+#endif
     }
 
     return {};
   }
 
+  Result<CopyStats, FileError> FileWriter::copyFile(const std::filesystem::path &source,
+                                                    const std::filesystem::path &destination,
+                                                    const CopyOptions &options) const {
+    if (auto error = prepareTarget(destination)) {
+      return *error;
+    }
+
+    return createWithParents(destination,
+                             [&] { return utils::copyFile(source, destination, options); });
+  }
+
+  Result<std::unique_ptr<IFileAppender>, FileError>
+      FileWriter::openAppender(const std::filesystem::path &filePath,
+                               const AppenderOptions &options) const {
+    if (auto error = prepareTarget(filePath)) {
+      return *error;
+    }
+
+    auto appender =
+        createWithParents(filePath, [&] { return FileAppender::open(filePath, options); });
+    if (!appender) {
+      return appender.error();
+    }
+    return std::unique_ptr<IFileAppender>(std::move(appender).value());
+  }
+
+  Result<MappedOutput, FileError> FileWriter::openMapped(const std::filesystem::path &filePath,
+                                                         std::size_t capacity) const {
+    if (auto error = prepareTarget(filePath)) {
+      return *error;
+    }
+
+    // As for the other writes, parent directories are only created once found missing
+    return createWithParents(filePath, [&] { return MappedOutput::create(filePath, capacity); });
+  }
+
   std::optional<FileError> FileWriter::validatePath(const std::filesystem::path &filePath,
                                                     bool requireParent) {
     if (filePath.empty()) {
@@ -162,14 +667,12 @@ namespace dotnamecpp::utils {
     std::error_code ec;
 
     // Check if path exists and is a directory
-    if (std::filesystem::exists(filePath, ec) && !ec) {
-      if (std::filesystem::is_directory(filePath, ec) || ec) {
-        return FileError{
-            .code = FileErrorCode::IsDirectory,
-            .message = "Path is a directory, not a file",
-            .path = filePath.string(),
-        };
-      }
+    if (std::filesystem::is_directory(std::filesystem::status(filePath, ec)) && !ec) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
     }
 
     if (requireParent) {
@@ -187,27 +690,26 @@ namespace dotnamecpp::utils {
   }
 
   std::optional<FileError> FileWriter::ensureParentExists(const std::filesystem::path &filePath) {
-    auto parent = filePath.parent_path();
-    if (parent.empty()) {
-      return std::nullopt; // No parent to create
-    }
-
-    std::error_code ec;
-    if (std::filesystem::exists(parent, ec) && !ec) {
-      return std::nullopt; // Parent already exists
-    }
+    return createParentDirectories(filePath);
+  }
 
-    // Create parent directories
-    std::filesystem::create_directories(parent, ec);
-    if (ec) {
+  std::optional<FileError> FileWriter::prepareTarget(const std::filesystem::path &filePath) {
+#ifndef _WIN32
+    // open() reports directories (EISDIR) and missing parents (ENOENT) by itself
+    if (filePath.empty()) {
       return FileError{
-          .code = FileErrorCode::WriteError,
-          .message = fmt::format("Failed to create parent directory: {}", ec.message()),
-          .path = parent.string(),
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
       };
     }
-
     return std::nullopt;
+#else
+    if (auto error = validatePath(filePath, false)) {
+      return error;
+    }
+    return ensureParentExists(filePath);
+#endif
   }
 
 } // namespace dotnamecpp::utils
\ No newline at end of file
@@ -22,14 +22,38 @@ namespace dotnamecpp::utils {
                                        const std::vector<uint8_t> &data,
                                        bool append = false) const override;
 
+    [[nodiscard]]
+    Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                       std::span<const uint8_t> data,
+                                       const WriteOptions &options) const override;
+
     [[nodiscard]]
     Result<void, FileError> writeLines(const std::filesystem::path &filePath,
                                        const std::vector<std::string> &lines,
                                        bool append = false) const override;
 
+    [[nodiscard]]
+    Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                       std::span<const std::string_view> lines,
+                                       bool append = false) const override;
+
     [[nodiscard]]
     Result<void, FileError> touch(const std::filesystem::path &filePath) const override;
 
+    [[nodiscard]]
+    Result<CopyStats, FileError> copyFile(const std::filesystem::path &source,
+                                          const std::filesystem::path &destination,
+                                          const CopyOptions &options = {}) const override;
+
+    [[nodiscard]]
+    Result<std::unique_ptr<IFileAppender>, FileError>
+        openAppender(const std::filesystem::path &filePath,
+                     const AppenderOptions &options = {}) const override;
+
+    [[nodiscard]]
+    Result<MappedOutput, FileError> openMapped(const std::filesystem::path &filePath,
+                                               std::size_t capacity) const override;
+
   private:
     [[nodiscard]]
     static std::optional<FileError> validatePath(const std::filesystem::path &filePath,
@@ -37,6 +61,11 @@ namespace dotnamecpp::utils {
 
     [[nodiscard]]
     static std::optional<FileError> ensureParentExists(const std::filesystem::path &filePath);
+
+    // Checks before a write opens its file; cheaper than validatePath + ensureParentExists
+    // where open() reports directories and missing parents itself
+    [[nodiscard]]
+    static std::optional<FileError> prepareTarget(const std::filesystem::path &filePath);
   };
 
 } // namespace dotnamecpp::utils
\ No newline at end of file
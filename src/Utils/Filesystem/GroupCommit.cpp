@@ -0,0 +1,109 @@
+#include "GroupCommit.hpp"
+
+#ifndef _WIN32
+
+#include <cerrno>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace dotnamecpp::utils {
+
+  namespace {
+
+    int syncDescriptor(int fd, bool metadata) {
+      int error = 0;
+      do {
+        error = (metadata ? ::fsync(fd) : ::fdatasync(fd)) == 0 ? 0 : errno;
+      } while (error == EINTR);
+      return error;
+    }
+
+  } // namespace
+
+  GroupCommit::GroupCommit(SyncFunction syncFunction)
+      : syncFunction_(syncFunction ? std::move(syncFunction) : SyncFunction(syncDescriptor)) {}
+
+  GroupCommit &GroupCommit::shared() {
+    static GroupCommit groupCommit;
+    return groupCommit;
+  }
+
+  int GroupCommit::sync(int fd, bool metadata) {
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+      return errno;
+    }
+
+    const Key key{info.st_dev, info.st_ino};
+    std::shared_ptr<Group> group;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &slot = groups_[key];
+      if (!slot) {
+        slot = std::make_shared<Group>();
+      }
+      group = slot;
+      ++group->users;
+    }
+
+    const int result = syncGroup(*group, fd, metadata);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (--group->users == 0) {
+        groups_.erase(key);
+      }
+    }
+    return result;
+  }
+
+  std::uint64_t GroupCommit::syncCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return syncCount_;
+  }
+
+  int GroupCommit::syncGroup(Group &group, int fd, bool metadata) {
+    std::unique_lock<std::mutex> lock(group.mutex);
+    // The caller's data was written before this point, so any sync starting later covers it
+    const std::uint64_t ticket = ++group.requested;
+
+    for (;;) {
+      if (group.durable >= ticket) {
+        return 0;
+      }
+      if (group.covered >= ticket) {
+        return group.error; // Covered by a failed sync, or by one after a failure
+      }
+      if (group.syncing) {
+        group.done.wait(lock);
+        continue;
+      }
+
+      // Leader: one sync for every ticket handed out so far
+      group.syncing = true;
+      const std::uint64_t target = group.requested;
+      lock.unlock();
+
+      const int error = syncFunction_(fd, metadata);
+      {
+        std::lock_guard<std::mutex> countLock(mutex_);
+        ++syncCount_;
+      }
+
+      lock.lock();
+      group.syncing = false;
+      group.covered = target;
+      if (group.error == 0) {
+        if (error == 0) {
+          group.durable = target;
+        } else {
+          group.error = error;
+        }
+      }
+      group.done.notify_all();
+    }
+  }
+
+} // namespace dotnamecpp::utils
+
+#endif // _WIN32
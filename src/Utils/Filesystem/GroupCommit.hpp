@@ -0,0 +1,96 @@
+#pragma once
+
+#ifndef _WIN32
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sys/types.h>
+#include <utility>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Shares fdatasync / fsync calls between threads persisting the same file
+   *
+   * Callers of one file (identified by device and inode, so different descriptors of it
+   * meet) form a group. A caller finding no sync in flight becomes the leader and syncs
+   * everything written so far; callers arriving meanwhile wait and are then acknowledged
+   * together by the next sync. N concurrent durable writes to a file thus cost about two
+   * syncs instead of N, while each call still returns only once its own data is durable.
+   *
+   * After a failed sync the kernel may already have dropped the dirty pages, so a later
+   * successful sync proves nothing about them: from then on every caller of the group gets
+   * the first error, until the group is released by its last concurrent user.
+   */
+  class GroupCommit final {
+  public:
+    // Performs the actual sync of a descriptor, returning 0 or an errno value
+    using SyncFunction = std::function<int(int fd, bool metadata)>;
+
+    /**
+     * @brief Create an instance
+     *
+     * @param syncFunction Replaces fdatasync / fsync, e.g. to hold or fail syncs in tests;
+     * empty uses the system calls
+     */
+    explicit GroupCommit(SyncFunction syncFunction = {});
+    ~GroupCommit() = default;
+
+    GroupCommit(const GroupCommit &) = delete;
+    GroupCommit &operator=(const GroupCommit &) = delete;
+    GroupCommit(GroupCommit &&) = delete;
+    GroupCommit &operator=(GroupCommit &&) = delete;
+
+    /**
+     * @brief Process-wide instance
+     *
+     * @return GroupCommit&
+     */
+    static GroupCommit &shared();
+
+    /**
+     * @brief Make everything written to the file before the call durable
+     *
+     * @param fd Any descriptor of the file
+     * @param metadata fsync instead of fdatasync, e.g. for directories
+     * @return 0, or the errno of the failed sync covering this call
+     */
+    int sync(int fd, bool metadata = false);
+
+    /**
+     * @brief Number of sync system calls issued so far
+     *
+     * @return std::uint64_t
+     */
+    [[nodiscard]]
+    std::uint64_t syncCount() const;
+
+  private:
+    struct Group {
+      std::mutex mutex;
+      std::condition_variable done;
+      std::uint64_t requested = 0; // Tickets handed out, one per sync() call
+      std::uint64_t covered = 0;   // Highest ticket a finished sync covered
+      std::uint64_t durable = 0;   // Covered tickets above this one failed
+      int error = 0;               // errno of the first failed sync, freezes durable
+      bool syncing = false;
+      std::size_t users = 0; // Guarded by GroupCommit::mutex_
+    };
+
+    using Key = std::pair<dev_t, ino_t>;
+
+    int syncGroup(Group &group, int fd, bool metadata);
+
+    SyncFunction syncFunction_;
+    mutable std::mutex mutex_;
+    std::map<Key, std::shared_ptr<Group>> groups_;
+    std::uint64_t syncCount_ = 0;
+  };
+
+} // namespace dotnamecpp::utils
+
+#endif // _WIN32
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <Utils/Filesystem/FileCopy.hpp>
 #include <Utils/UtilsError.hpp>
 #include <filesystem>
 #include <vector>
@@ -43,6 +44,20 @@ namespace dotnamecpp::utils {
     virtual Result<std::uintmax_t, FileError>
         removeDirectoryRecursive(const std::filesystem::path &dirPath) const = 0;
 
+    /**
+     * @brief Copy a directory recursively, file data staying in the kernel where possible
+     *
+     * @param source
+     * @param destination
+     * @param options
+     * @return Result<std::uintmax_t, FileError> Number of files copied
+     */
+    [[nodiscard]]
+    virtual Result<std::uintmax_t, FileError>
+        copyDirectory(const std::filesystem::path &source,
+                      const std::filesystem::path &destination,
+                      const CopyOptions &options = {}) const = 0;
+
     /**
      * @brief Check if a directory exists
      *
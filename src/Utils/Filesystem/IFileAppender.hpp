@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Buffering and flush policy of an IFileAppender
+   *
+   */
+  struct AppenderOptions {
+    // Buffered bytes that trigger a flush; appends at least this large bypass the buffer
+    std::size_t bufferSize = 64 * 1024;
+    // Longest time appended data may stay buffered; zero disables time-based flushing
+    std::chrono::milliseconds flushInterval{1000};
+  };
+
+  /**
+   * @brief Open append handle of one file
+   *
+   * Keeps the file open and collects appends in a user-space buffer, which is written out
+   * when it reaches AppenderOptions::bufferSize, when AppenderOptions::flushInterval has
+   * passed since the oldest buffered byte, on flush() and on destruction. Safe to use from
+   * several threads; every append lands in the file as one contiguous piece. Bytes a failed
+   * write could not store stay buffered and are written, in order, by the next flush.
+   */
+  class IFileAppender {
+  public:
+    virtual ~IFileAppender() = default;
+
+    /**
+     * @brief Append data
+     *
+     * The data is taken even when an error is returned: it is either in the file or still
+     * buffered for the next flush.
+     *
+     * @param data
+     * @return Result<void, FileError> A failed background flush since the last append() or
+     * flush() takes precedence over the failure of this append
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> append(std::string_view data) = 0;
+
+    /**
+     * @brief Append data followed by a newline
+     *
+     * @param line
+     * @return Result<void, FileError> As for append()
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> appendLine(std::string_view line) = 0;
+
+    /**
+     * @brief Write all buffered data to the file
+     *
+     * @return Result<void, FileError> The failure of an earlier background flush, if any,
+     * takes precedence over that of this one
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> flush() = 0;
+
+    /**
+     * @brief Number of appended bytes not yet written to the file
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    virtual std::size_t pendingBytes() const = 0;
+
+    [[nodiscard]]
+    virtual const std::filesystem::path &path() const noexcept = 0;
+  };
+
+} // namespace dotnamecpp::utils
@@ -1,13 +1,70 @@
 #pragma once
 
+#include <Utils/Filesystem/BufferPool.hpp>
+#include <Utils/Filesystem/Checksum.hpp>
+#include <Utils/Filesystem/LineView.hpp>
+#include <Utils/Filesystem/MappedFile.hpp>
+#include <Utils/Filesystem/ReadHints.hpp>
 #include <Utils/UtilsError.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <memory_resource>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dotnamecpp::utils {
 
+  /**
+   * @brief Default buffer size of the streaming read operations
+   *
+   */
+  inline constexpr std::size_t kDefaultReadChunkSize = 256 * 1024;
+
+  /**
+   * @brief Options of IFileReader::readChunks
+   *
+   */
+  struct ReadChunkOptions {
+    // Size of each delivered chunk, only the last one may be shorter
+    std::size_t chunkSize = kDefaultReadChunkSize;
+    // Read the next chunk on a helper thread while the current one is processed
+    bool readAhead = false;
+    // Page cache hints, none by default; with dropAfterRead every chunk is dropped once it
+    // was read. Whole-file scans may ask for AccessPattern::Sequential.
+    ReadHints hints{};
+  };
+
+  class IoThreadPool;
+
+  /**
+   * @brief Options of IFileReader::readParallel and IFileReader::readRangesParallel
+   *
+   */
+  struct ParallelReadOptions {
+    // Maximum number of byte ranges read concurrently, 0 uses the size of the pool
+    std::size_t parallelism = 0;
+    // Files are not split into ranges smaller than this
+    std::size_t minRangeSize = 4 * 1024 * 1024;
+    // Size of the pieces handed to a range callback
+    std::size_t chunkSize = kDefaultReadChunkSize;
+    // Pool running the reads, nullptr uses IoThreadPool::shared()
+    IoThreadPool *pool = nullptr;
+  };
+
+  /**
+   * @brief Content of a file together with its digest, see IFileReader::readWithChecksum
+   *
+   */
+  struct ChecksummedContent {
+    std::string content;
+    std::uint64_t checksum = 0;
+  };
+
   /**
    * @brief Interface for reading file content
    *
@@ -16,6 +73,35 @@ namespace dotnamecpp::utils {
    */
   class IFileReader {
   public:
+    /**
+     * @brief Receives one line; returning false stops the iteration
+     *
+     */
+    using LineCallback = std::function<bool(std::string_view line)>;
+
+    /**
+     * @brief Receives one chunk of a file; returning false stops the iteration
+     *
+     */
+    using ChunkCallback = std::function<bool(std::span<const std::byte> chunk)>;
+
+    /**
+     * @brief Receives a piece of a file and its offset, concurrently from several threads;
+     * returning false stops all workers
+     *
+     */
+    using RangeCallback =
+        std::function<bool(std::uintmax_t offset, std::span<const std::byte> data)>;
+
+    /**
+     * @brief Receives the outcome of one file of an asynchronous batch read
+     *
+     */
+    using ReadCompletion = std::function<void(const std::filesystem::path &filePath,
+                                              Result<std::string, FileError> result)>;
+
+    static constexpr std::size_t kDefaultChunkSize = kDefaultReadChunkSize;
+
     virtual ~IFileReader() = default;
 
     /**
@@ -37,6 +123,56 @@ namespace dotnamecpp::utils {
     virtual Result<std::vector<uint8_t>, FileError>
         readBytes(const std::filesystem::path &filePath) const = 0;
 
+    /**
+     * @brief Read a file into a caller-provided buffer
+     *
+     * @param filePath
+     * @param buffer
+     * @return Result<std::size_t, FileError> Bytes read; ReadError if the file does not fit
+     */
+    [[nodiscard]]
+    virtual Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                                    std::span<std::byte> buffer) const = 0;
+
+    /**
+     * @brief Read a file into a std::pmr::string, replacing its content
+     *
+     * Memory comes from the string's memory resource and its existing capacity is reused, so
+     * a string kept across reads stops allocating once it is large enough.
+     *
+     * @param filePath
+     * @param buffer
+     * @return Result<std::size_t, FileError> Bytes read
+     */
+    [[nodiscard]]
+    virtual Result<std::size_t, FileError> readInto(const std::filesystem::path &filePath,
+                                                    std::pmr::string &buffer) const = 0;
+
+    /**
+     * @brief Read a file into a buffer leased from a pool
+     *
+     * @param filePath
+     * @param pool
+     * @return Result<BufferPool::Buffer, FileError> Returned to the pool when destroyed
+     */
+    [[nodiscard]]
+    virtual Result<BufferPool::Buffer, FileError>
+        readPooled(const std::filesystem::path &filePath, BufferPool &pool) const = 0;
+
+    /**
+     * @brief Map the entire content of a file without copying it
+     *
+     * Preferred over read()/readBytes() for large inputs: the returned MappedFile owns the
+     * mapping and exposes it as std::span<const std::byte> or std::string_view.
+     *
+     * @param filePath
+     * @param hints Access pattern passed to madvise
+     * @return Result<MappedFile, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<MappedFile, FileError> readMapped(const std::filesystem::path &filePath,
+                                                     const ReadHints &hints = {}) const = 0;
+
     /**
      * @brief Read the content of a file as a vector of lines
      *
@@ -47,6 +183,156 @@ namespace dotnamecpp::utils {
     virtual Result<std::vector<std::string>, FileError>
         readLines(const std::filesystem::path &filePath) const = 0;
 
+    /**
+     * @brief Read a file once and view its lines without a per-line allocation
+     *
+     * @param filePath
+     * @return Result<LineView, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<LineView, FileError>
+        readLineView(const std::filesystem::path &filePath) const = 0;
+
+    /**
+     * @brief Stream the lines of a file of any size through a fixed-size buffer
+     *
+     * Lines are passed as views into the buffer and are only valid during the callback.
+     * The buffer grows only for lines longer than chunkSize.
+     *
+     * @param filePath
+     * @param callback
+     * @param chunkSize
+     * @return Result<std::size_t, FileError> Number of lines passed to the callback
+     */
+    [[nodiscard]]
+    virtual Result<std::size_t, FileError> forEachLine(const std::filesystem::path &filePath,
+                                                       const LineCallback &callback,
+                                                       std::size_t chunkSize = kDefaultChunkSize)
+        const = 0;
+
+    /**
+     * @brief Stream a file of any size in fixed-size chunks from reused buffers
+     *
+     * Memory use is bounded by one buffer (two with read-ahead), independent of the file size.
+     * A chunk is only valid during the callback.
+     *
+     * @param filePath
+     * @param callback
+     * @param options
+     * @return Result<std::uintmax_t, FileError> Number of bytes passed to the callback
+     */
+    [[nodiscard]]
+    virtual Result<std::uintmax_t, FileError> readChunks(const std::filesystem::path &filePath,
+                                                         const ChunkCallback &callback,
+                                                         const ReadChunkOptions &options = {})
+        const = 0;
+
+    /**
+     * @brief Read a whole file by splitting it into byte ranges read concurrently
+     *
+     * Each range is read with positional reads straight into its part of one preallocated
+     * buffer. Worth it for large files on devices that need several requests in flight
+     * (NVMe, network filesystems); small files are read as a single range. Called from a
+     * worker of the pool itself, the ranges are read one after another on that worker.
+     *
+     * @param filePath
+     * @param options
+     * @return Result<std::vector<uint8_t>, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<std::vector<uint8_t>, FileError>
+        readParallel(const std::filesystem::path &filePath,
+                     const ParallelReadOptions &options = {}) const = 0;
+
+    /**
+     * @brief Process a file in place by byte ranges read concurrently
+     *
+     * Every worker reads its range in pieces of options.chunkSize into its own buffer and
+     * passes them to the callback, which must therefore be thread-safe. Pieces arrive in
+     * offset order within a range, but ranges are processed in parallel. An exception thrown
+     * by the callback stops the other ranges early and is rethrown once all of them are done.
+     * Called from a worker of the pool itself, the ranges are read one after another.
+     *
+     * @param filePath
+     * @param callback
+     * @param options
+     * @return Result<std::uintmax_t, FileError> Number of bytes passed to the callback
+     */
+    [[nodiscard]]
+    virtual Result<std::uintmax_t, FileError>
+        readRangesParallel(const std::filesystem::path &filePath, const RangeCallback &callback,
+                           const ParallelReadOptions &options = {}) const = 0;
+
+    /**
+     * @brief Start reading a batch of files concurrently
+     *
+     * All reads are queued at once, so their latencies overlap instead of adding up.
+     *
+     * @param filePaths
+     * @param pool Pool running the reads, nullptr uses IoThreadPool::shared()
+     * @return One future per path, in the order of filePaths
+     */
+    [[nodiscard]]
+    virtual std::vector<std::future<Result<std::string, FileError>>>
+        readAsync(const std::vector<std::filesystem::path> &filePaths,
+                  IoThreadPool *pool = nullptr) const = 0;
+
+    /**
+     * @brief Start reading a batch of files concurrently, reporting each one as it completes
+     *
+     * The completion runs on a pool thread, in completion order, and must be thread-safe.
+     * An exception thrown by it is passed on through the returned future.
+     *
+     * @param filePaths
+     * @param onComplete
+     * @param pool Pool running the reads, nullptr uses IoThreadPool::shared()
+     * @return Future satisfied once every completion has returned
+     */
+    virtual std::future<void> readAsync(const std::vector<std::filesystem::path> &filePaths,
+                                        ReadCompletion onComplete,
+                                        IoThreadPool *pool = nullptr) const = 0;
+
+    /**
+     * @brief Read a whole file and compute its digest in the same pass
+     *
+     * Each piece is hashed right after it was read, while it is still in the CPU cache, so
+     * verifying the content costs no second pass over memory.
+     *
+     * @param filePath
+     * @param algorithm
+     * @return Result<ChecksummedContent, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<ChecksummedContent, FileError>
+        readWithChecksum(const std::filesystem::path &filePath,
+                         ChecksumAlgorithm algorithm) const = 0;
+
+    /**
+     * @brief Digest of a file, streamed chunk by chunk without holding the whole file
+     *
+     * @param filePath
+     * @param algorithm
+     * @param options Chunking and page cache hints of the underlying readChunks()
+     * @return Result<std::uint64_t, FileError> Same value as Checksum::digest()
+     */
+    [[nodiscard]]
+    virtual Result<std::uint64_t, FileError>
+        hashFile(const std::filesystem::path &filePath, ChecksumAlgorithm algorithm,
+                 const ReadChunkOptions &options = {}) const = 0;
+
+    /**
+     * @brief Start loading files into the page cache without reading them
+     *
+     * Meant for files that are about to be read, so the later reads do not wait for the disk.
+     * Missing or unreadable files are skipped.
+     *
+     * @param filePaths
+     * @param pool Pool issuing the hints, nullptr uses IoThreadPool::shared()
+     * @return Future satisfied once every file was handed to the kernel
+     */
+    virtual std::future<void> prefetch(const std::vector<std::filesystem::path> &filePaths,
+                                       IoThreadPool *pool = nullptr) const = 0;
+
     /**
      * @brief Check if a file exists
      *
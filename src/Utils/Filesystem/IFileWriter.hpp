@@ -1,13 +1,38 @@
 #pragma once
 
+#include <Utils/Filesystem/FileCopy.hpp>
+#include <Utils/Filesystem/IFileAppender.hpp>
+#include <Utils/Filesystem/MappedOutput.hpp>
 #include <Utils/UtilsError.hpp>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace dotnamecpp::utils {
 
+  /**
+   * @brief Allocation and durability options of a binary write
+   *
+   */
+  struct WriteOptions {
+    bool append = false;
+    // Reserve the file's final size before writing (fallocate), so the file system can
+    // allocate contiguous extents once instead of growing the file write by write
+    bool preallocate = false;
+    // Leave all-zero blocks unwritten, as holes; takes precedence over preallocate
+    bool sparse = false;
+    // Granularity of the zero-block check, aligned to file offsets
+    std::size_t sparseBlockSize = 4096;
+    // Return only once the data is on stable storage. Appends are synced with fdatasync,
+    // shared between concurrent writers of the file; other writes replace the file through
+    // a synced temporary file and rename, so a crash never leaves partial content
+    bool durable = false;
+  };
+
   /**
    * @brief Interface for writing file content
    *
@@ -44,6 +69,19 @@ namespace dotnamecpp::utils {
                                                const std::vector<uint8_t> &data,
                                                bool append = false) const = 0;
 
+    /**
+     * @brief Write binary data to file with preallocation or hole-preserving writes
+     *
+     * @param filePath
+     * @param data
+     * @param options
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> writeBytes(const std::filesystem::path &filePath,
+                                               std::span<const uint8_t> data,
+                                               const WriteOptions &options) const = 0;
+
     /**
      * @brief Write lines to file (each string becomes one line)
      *
@@ -57,6 +95,19 @@ namespace dotnamecpp::utils {
                                                const std::vector<std::string> &lines,
                                                bool append = false) const = 0;
 
+    /**
+     * @brief Write lines to file without copying them into owned strings
+     *
+     * @param filePath
+     * @param lines
+     * @param append
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<void, FileError> writeLines(const std::filesystem::path &filePath,
+                                               std::span<const std::string_view> lines,
+                                               bool append = false) const = 0;
+
     /**
      * @brief Create empty file or update timestamp of existing file
      *
@@ -65,6 +116,51 @@ namespace dotnamecpp::utils {
      */
     [[nodiscard]]
     virtual Result<void, FileError> touch(const std::filesystem::path &filePath) const = 0;
+
+    /**
+     * @brief Copy a file, reflinking or copying inside the kernel where possible
+     *
+     * Missing parent directories of the destination are created.
+     *
+     * @param source
+     * @param destination
+     * @param options
+     * @return Result<CopyStats, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<CopyStats, FileError> copyFile(const std::filesystem::path &source,
+                                                  const std::filesystem::path &destination,
+                                                  const CopyOptions &options = {}) const = 0;
+
+    /**
+     * @brief Open a persistent, buffered append handle, creating the file if missing
+     *
+     * Cheaper than repeated write(..., true) for many small appends: the file is opened once
+     * and data is written in batches.
+     *
+     * @param filePath
+     * @param options
+     * @return Result<std::unique_ptr<IFileAppender>, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<std::unique_ptr<IFileAppender>, FileError>
+        openAppender(const std::filesystem::path &filePath,
+                     const AppenderOptions &options = {}) const = 0;
+
+    /**
+     * @brief Map a new output for a file, creating missing parent directories
+     *
+     * Lets large outputs be serialized in place instead of through a vector passed to
+     * writeBytes(), which holds the whole content in memory once more. An existing file is
+     * replaced only once the output is committed.
+     *
+     * @param filePath
+     * @param capacity Upper bound of the final size; commit() truncates to the length used
+     * @return Result<MappedOutput, FileError>
+     */
+    [[nodiscard]]
+    virtual Result<MappedOutput, FileError> openMapped(const std::filesystem::path &filePath,
+                                                       std::size_t capacity) const = 0;
   };
 
 } // namespace dotnamecpp::utils
\ No newline at end of file
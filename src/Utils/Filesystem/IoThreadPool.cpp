@@ -0,0 +1,67 @@
+#include "IoThreadPool.hpp"
+#include <algorithm>
+
+namespace dotnamecpp::utils {
+
+  namespace {
+    // Pool whose worker loop runs on this thread, if any
+    thread_local const IoThreadPool *currentPool = nullptr;
+  } // namespace
+
+  IoThreadPool::IoThreadPool(std::size_t threadCount) {
+    const std::size_t count = threadCount == 0 ? defaultThreadCount() : threadCount;
+    workers_.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+      workers_.emplace_back(&IoThreadPool::workerLoop, this);
+    }
+  }
+
+  IoThreadPool::~IoThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    cv_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  void IoThreadPool::post(std::function<void()> task) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+  }
+
+  bool IoThreadPool::isWorkerThread() const noexcept { return currentPool == this; }
+
+  std::size_t IoThreadPool::defaultThreadCount() {
+    return std::max<std::size_t>(std::thread::hardware_concurrency(), 2);
+  }
+
+  IoThreadPool &IoThreadPool::shared() {
+    static IoThreadPool pool;
+    return pool;
+  }
+
+  void IoThreadPool::workerLoop() {
+    currentPool = this;
+    for (;;) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stopping_ || !tasks_.empty(); });
+        // Drain the queue before stopping so no submitted future is left unsatisfied
+        if (tasks_.empty()) {
+          return;
+        }
+        task = std::move(tasks_.front());
+        tasks_.pop_front();
+      }
+      task();
+    }
+  }
+
+} // namespace dotnamecpp::utils
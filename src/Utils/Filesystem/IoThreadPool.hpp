@@ -0,0 +1,105 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Fixed-size pool of threads for blocking file I/O
+   *
+   * Tasks run in submission order on the first free worker. Tasks must not block on the
+   * completion of other tasks of the same pool, otherwise a saturated pool deadlocks; code
+   * that may run on a worker can check isWorkerThread() and do its work inline instead.
+   */
+  class IoThreadPool final {
+  public:
+    /**
+     * @brief Create a pool
+     *
+     * @param threadCount Number of workers, 0 selects defaultThreadCount()
+     */
+    explicit IoThreadPool(std::size_t threadCount = 0);
+    ~IoThreadPool();
+
+    IoThreadPool(const IoThreadPool &) = delete;
+    IoThreadPool &operator=(const IoThreadPool &) = delete;
+    IoThreadPool(IoThreadPool &&) = delete;
+    IoThreadPool &operator=(IoThreadPool &&) = delete;
+
+    /**
+     * @brief Queue a task without a result
+     *
+     * @param task
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * @brief Queue a task and get a future of its result
+     *
+     * @tparam Func
+     * @param func
+     * @return std::future<std::invoke_result_t<Func>>
+     */
+    template <typename Func>
+    auto submit(Func &&func) -> std::future<std::invoke_result_t<Func>> {
+      using ResultType = std::invoke_result_t<Func>;
+      auto task = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Func>(func));
+      auto future = task->get_future();
+      post([task] { (*task)(); });
+      return future;
+    }
+
+    /**
+     * @brief Number of worker threads
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return workers_.size();
+    }
+
+    /**
+     * @brief Whether the calling thread is one of this pool's workers
+     *
+     * @return bool
+     */
+    [[nodiscard]]
+    bool isWorkerThread() const noexcept;
+
+    /**
+     * @brief Worker count used when none is given: the hardware concurrency, at least 2
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    static std::size_t defaultThreadCount();
+
+    /**
+     * @brief Process-wide pool shared by FileReader's parallel and asynchronous reads
+     *
+     * @return IoThreadPool&
+     */
+    static IoThreadPool &shared();
+
+  private:
+    void workerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> tasks_;
+    bool stopping_ = false;
+    std::vector<std::thread> workers_;
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <Utils/Filesystem/MappedFile.hpp>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Range of the lines of a file, each one a std::string_view into a single buffer
+   *
+   * The file is mapped (or read once) and never copied per line. Newlines are located with
+   * memchr, which the C library vectorizes. Line terminators, "\n" as well as "\r\n", are not
+   * part of the lines; like std::getline, a trailing newline does not produce an empty last
+   * line. The views are valid as long as the LineView exists.
+   */
+  class LineView final {
+  public:
+    class Iterator {
+    public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = std::string_view;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const std::string_view *;
+      using reference = const std::string_view &;
+
+      Iterator() = default;
+      explicit Iterator(std::string_view text) : rest_(text), atEnd_(false) { ++*this; }
+
+      reference operator*() const noexcept { return line_; }
+      pointer operator->() const noexcept { return &line_; }
+
+      Iterator &operator++() noexcept {
+        if (rest_.empty()) {
+          atEnd_ = true;
+          line_ = {};
+        } else {
+          takeLine(rest_, line_);
+        }
+        return *this;
+      }
+
+      Iterator operator++(int) noexcept {
+        Iterator previous = *this;
+        ++*this;
+        return previous;
+      }
+
+      bool operator==(const Iterator &other) const noexcept {
+        return atEnd_ == other.atEnd_ && (atEnd_ || line_.data() == other.line_.data());
+      }
+
+    private:
+      std::string_view rest_;
+      std::string_view line_;
+      bool atEnd_ = true;
+    };
+
+    LineView() = default;
+    explicit LineView(MappedFile file) : file_(std::move(file)) {}
+
+    [[nodiscard]]
+    Iterator begin() const {
+      return Iterator(file_.view());
+    }
+
+    [[nodiscard]]
+    Iterator end() const {
+      return {};
+    }
+
+    /**
+     * @brief Whole content the lines point into
+     *
+     * @return std::string_view
+     */
+    [[nodiscard]]
+    std::string_view text() const noexcept {
+      return file_.view();
+    }
+
+    /**
+     * @brief Cut the first line off a text
+     *
+     * @param text Remaining text, advanced past the line and its terminator
+     * @param line The line without "\n" or "\r\n"
+     * @return true if the line was terminated by a newline, false if it ran to the end of text
+     */
+    static bool takeLine(std::string_view &text, std::string_view &line) noexcept {
+      const void *newline = text.empty() ? nullptr : std::memchr(text.data(), '\n', text.size());
+      const std::size_t length =
+          newline == nullptr ? text.size() : static_cast<const char *>(newline) - text.data();
+      line = text.substr(0, length);
+      text.remove_prefix(newline == nullptr ? length : length + 1);
+      if (!line.empty() && line.back() == '\r') {
+        line.remove_suffix(1);
+      }
+      return newline != nullptr;
+    }
+
+  private:
+    MappedFile file_;
+  };
+
+} // namespace dotnamecpp::utils
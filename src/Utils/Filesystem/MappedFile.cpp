@@ -0,0 +1,182 @@
+#include "MappedFile.hpp"
+#include <Utils/Filesystem/FileDescriptor.hpp>
+#include <utility>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+  MappedFile::~MappedFile() { release(); }
+
+  MappedFile::MappedFile(MappedFile &&other) noexcept
+      : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)),
+        mapped_(std::exchange(other.mapped_, false)), buffer_(std::move(other.buffer_)) {
+    if (!mapped_) {
+      data_ = buffer_.data();
+    }
+  }
+
+  MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+      release();
+      data_ = std::exchange(other.data_, nullptr);
+      size_ = std::exchange(other.size_, 0);
+      mapped_ = std::exchange(other.mapped_, false);
+      buffer_ = std::move(other.buffer_);
+      if (!mapped_) {
+        data_ = buffer_.data();
+      }
+    }
+    return *this;
+  }
+
+#ifdef _WIN32
+
+  void MappedFile::release() noexcept {
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  Result<MappedFile, FileError> MappedFile::open(const std::filesystem::path &filePath,
+                                                 const ReadHints & /*hints*/) {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    std::error_code ec;
+    if (std::filesystem::is_directory(filePath, ec)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+      return FileError{
+          .code = std::filesystem::exists(filePath, ec) ? FileErrorCode::ReadError
+                                                        : FileErrorCode::NotFound,
+          .message = "Failed to open file for reading",
+          .path = filePath.string(),
+      };
+    }
+
+    file.seekg(0, std::ios::end);
+    const std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    MappedFile result;
+    result.buffer_.resize(size > 0 ? static_cast<std::size_t>(size) : 0);
+    if (!file.read(reinterpret_cast<char *>(result.buffer_.data()),
+                   static_cast<std::streamsize>(result.buffer_.size()))) {
+      return FileError{
+          .code = FileErrorCode::ReadError,
+          .message = "I/O error while reading file",
+          .path = filePath.string(),
+      };
+    }
+    result.data_ = result.buffer_.data();
+    result.size_ = result.buffer_.size();
+    return result;
+  }
+
+#else
+
+  void MappedFile::release() noexcept {
+    if (mapped_ && data_ != nullptr) {
+      ::munmap(const_cast<std::byte *>(data_), size_);
+    }
+    buffer_.clear();
+    data_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+  }
+
+  Result<MappedFile, FileError> MappedFile::open(const std::filesystem::path &filePath,
+                                                 const ReadHints &hints) {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    FileDescriptor fd = FileDescriptor::open(filePath, O_RDONLY);
+    if (!fd) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError,
+                                "Failed to open file for reading", filePath);
+    }
+
+    struct stat info {};
+    if (::fstat(fd.get(), &info) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::ReadError, "Failed to stat file", filePath);
+    }
+    if (S_ISDIR(info.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+
+    MappedFile result;
+    if (S_ISREG(info.st_mode) && info.st_size > 0) {
+      const auto size = static_cast<std::size_t>(info.st_size);
+      void *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd.get(), 0);
+      if (mapping != MAP_FAILED) {
+        // The mapping keeps the file referenced, the descriptor is no longer needed
+        result.data_ = static_cast<const std::byte *>(mapping);
+        result.size_ = size;
+        result.mapped_ = true;
+        if (hints.pattern == AccessPattern::Sequential) {
+          ::madvise(mapping, size, MADV_SEQUENTIAL);
+        } else if (hints.pattern == AccessPattern::Random) {
+          ::madvise(mapping, size, MADV_RANDOM);
+        }
+        if (hints.willNeed) {
+          ::madvise(mapping, size, MADV_WILLNEED);
+        }
+        return result;
+      }
+    }
+
+    // Not mappable: read whatever the descriptor delivers until end of file
+    adviseDescriptor(fd.get(), hints);
+    constexpr std::size_t kChunkSize = 64 * 1024;
+    std::size_t total = 0;
+    for (;;) {
+      result.buffer_.resize(total + kChunkSize);
+      const ssize_t received = readFully(fd.get(), result.buffer_.data() + total, kChunkSize);
+      if (received < 0) {
+        return fileErrorFromErrno(errno, FileErrorCode::ReadError,
+                                  "I/O error while reading file", filePath);
+      }
+      total += static_cast<std::size_t>(received);
+      if (static_cast<std::size_t>(received) < kChunkSize) {
+        break;
+      }
+    }
+    if (hints.dropAfterRead) {
+      dropCachedPages(fd.get());
+    }
+    result.buffer_.resize(total);
+    result.data_ = result.buffer_.data();
+    result.size_ = total;
+    return result;
+  }
+
+#endif // _WIN32
+
+} // namespace dotnamecpp::utils
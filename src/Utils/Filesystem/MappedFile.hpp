@@ -0,0 +1,99 @@
+#pragma once
+
+#include <Utils/Filesystem/ReadHints.hpp>
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Read-only view of a whole file backed by a memory mapping
+   *
+   * Regular files are mapped with mmap, so their content is available without copying it into
+   * the process heap. Pipes, character devices and files reporting a size of zero (e.g. procfs)
+   * cannot be mapped and are read into an owned buffer instead; so is every file on Windows.
+   * The view stays valid for the lifetime of the object, which is move-only. Truncating a
+   * mapped file from another process while it is being read raises SIGBUS.
+   */
+  class MappedFile final {
+  public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    /**
+     * @brief Map (or read, if it cannot be mapped) the whole content of a file
+     *
+     * @param filePath
+     * @param hints Passed to madvise for a mapping; dropAfterRead only applies when the file
+     * is read into the buffer
+     * @return Result<MappedFile, FileError>
+     */
+    [[nodiscard]]
+    static Result<MappedFile, FileError> open(const std::filesystem::path &filePath,
+                                              const ReadHints &hints = {});
+
+    /**
+     * @brief Content of the file as bytes
+     *
+     * @return std::span<const std::byte>
+     */
+    [[nodiscard]]
+    std::span<const std::byte> bytes() const noexcept {
+      return {data_, size_};
+    }
+
+    /**
+     * @brief Content of the file as characters
+     *
+     * @return std::string_view
+     */
+    [[nodiscard]]
+    std::string_view view() const noexcept {
+      return size_ == 0 ? std::string_view{}
+                        : std::string_view(reinterpret_cast<const char *>(data_), size_);
+    }
+
+    [[nodiscard]]
+    const std::byte *data() const noexcept {
+      return data_;
+    }
+
+    [[nodiscard]]
+    std::size_t size() const noexcept {
+      return size_;
+    }
+
+    [[nodiscard]]
+    bool empty() const noexcept {
+      return size_ == 0;
+    }
+
+    /**
+     * @brief Check whether the content is memory-mapped or held in an owned buffer
+     *
+     * @return true if mapped
+     */
+    [[nodiscard]]
+    bool isMapped() const noexcept {
+      return mapped_;
+    }
+
+  private:
+    void release() noexcept;
+
+    const std::byte *data_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<std::byte> buffer_; // Used when the file cannot be mapped
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,307 @@
+#include "MappedOutput.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include "GroupCommit.hpp"
+#include <atomic>
+#include <cstdint>
+#include <fmt/core.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+  namespace {
+
+    FileError alreadyCommitted(const std::filesystem::path &filePath) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Output is already committed",
+          .path = filePath.string(),
+      };
+    }
+
+  } // namespace
+
+  MappedOutput::~MappedOutput() { release(); }
+
+  MappedOutput::MappedOutput(MappedOutput &&other) noexcept
+      : path_(std::move(other.path_)), temporary_(std::move(other.temporary_)),
+        data_(std::exchange(other.data_, nullptr)), capacity_(std::exchange(other.capacity_, 0)),
+        open_(std::exchange(other.open_, false)), buffer_(std::move(other.buffer_))
+#ifndef _WIN32
+        ,
+        fd_(std::move(other.fd_))
+#endif
+  {
+#ifdef _WIN32
+    data_ = buffer_.data();
+#endif
+  }
+
+  MappedOutput &MappedOutput::operator=(MappedOutput &&other) noexcept {
+    if (this != &other) {
+      release();
+      path_ = std::move(other.path_);
+      temporary_ = std::move(other.temporary_);
+      data_ = std::exchange(other.data_, nullptr);
+      capacity_ = std::exchange(other.capacity_, 0);
+      open_ = std::exchange(other.open_, false);
+      buffer_ = std::move(other.buffer_);
+#ifdef _WIN32
+      data_ = buffer_.data();
+#else
+      fd_ = std::move(other.fd_);
+#endif
+    }
+    return *this;
+  }
+
+#ifdef _WIN32
+
+  void MappedOutput::release() noexcept {
+    // Nothing reached the disk yet
+    buffer_.clear();
+    data_ = nullptr;
+    capacity_ = 0;
+    open_ = false;
+  }
+
+  Result<MappedOutput, FileError> MappedOutput::create(const std::filesystem::path &filePath,
+                                                       std::size_t capacity) {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    std::error_code ec;
+    if (std::filesystem::is_directory(filePath, ec)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+
+    MappedOutput result;
+    result.path_ = filePath;
+    result.buffer_.resize(capacity);
+    result.data_ = result.buffer_.data();
+    result.capacity_ = capacity;
+    result.open_ = true;
+    return result;
+  }
+
+  Result<void, FileError> MappedOutput::sync() {
+    if (!open_) {
+      return alreadyCommitted(path_);
+    }
+    return {}; // Held in memory until commit()
+  }
+
+  Result<void, FileError> MappedOutput::commit(std::size_t length, bool /*durable*/) {
+    if (!open_) {
+      return alreadyCommitted(path_);
+    }
+    if (length > capacity_) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Committed length exceeds the capacity",
+          .path = path_.string(),
+      };
+    }
+
+    std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Failed to open file for writing",
+          .path = path_.string(),
+      };
+    }
+    file.write(reinterpret_cast<const char *>(buffer_.data()),
+               static_cast<std::streamsize>(length));
+    if (!file.flush()) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "I/O error while writing file",
+          .path = path_.string(),
+      };
+    }
+
+    release();
+    return {};
+  }
+
+#else
+
+  void MappedOutput::release() noexcept {
+    if (data_ != nullptr) {
+      ::munmap(data_, capacity_);
+    }
+    if (open_) {
+      ::unlink(temporary_.c_str()); // Never committed; the target was not touched
+    }
+    fd_.reset();
+    buffer_.clear();
+    data_ = nullptr;
+    capacity_ = 0;
+    open_ = false;
+  }
+
+  Result<MappedOutput, FileError> MappedOutput::create(const std::filesystem::path &filePath,
+                                                       std::size_t capacity) {
+    if (filePath.empty()) {
+      return FileError{
+          .code = FileErrorCode::InvalidPath,
+          .message = "Empty file path",
+          .path = "",
+      };
+    }
+
+    // The output is produced in a temporary file next to the target and renamed over it by
+    // commit(), so an existing file keeps its content until the new one is complete
+    struct stat existing{};
+    const bool existed = ::stat(filePath.c_str(), &existing) == 0;
+    if (existed && S_ISDIR(existing.st_mode)) {
+      return FileError{
+          .code = FileErrorCode::IsDirectory,
+          .message = "Path is a directory, not a file",
+          .path = filePath.string(),
+      };
+    }
+
+    static std::atomic<std::uint64_t> counter{0};
+    auto temporary = filePath;
+    temporary.replace_filename(fmt::format(".{}.{}.{}.tmp", filePath.filename().string(),
+                                           ::getpid(), counter++));
+
+    // A shared writable mapping needs a descriptor open for reading as well
+    FileDescriptor fd = FileDescriptor::open(temporary, O_RDWR | O_CREAT | O_EXCL);
+    if (!fd) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                "Failed to open file for writing", filePath);
+    }
+    if (existed) {
+      ::fchmod(fd.get(), existing.st_mode & 07777);
+    }
+
+    // From here on, an early return removes the temporary file again
+    MappedOutput result;
+    result.path_ = filePath;
+    result.temporary_ = std::move(temporary);
+    result.fd_ = std::move(fd);
+    result.open_ = true;
+    if (capacity == 0) {
+      return result; // Nothing to map
+    }
+
+    const auto length = static_cast<off_t>(capacity);
+    if (::ftruncate(result.fd_.get(), length) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to size file",
+                                filePath);
+    }
+
+    // Allocate the blocks now: a page fault finding the disk full would raise SIGBUS
+#if defined(__linux__)
+    int reserved = 0;
+    do {
+      reserved = ::fallocate(result.fd_.get(), 0, 0, length) == 0 ? 0 : errno;
+    } while (reserved == EINTR);
+#elif !defined(__APPLE__)
+    const int reserved = ::posix_fallocate(result.fd_.get(), 0, length);
+#else
+    const int reserved = 0;
+#endif
+    if (reserved == ENOSPC || reserved == EFBIG) {
+      return fileErrorFromErrno(reserved, FileErrorCode::WriteError,
+                                "Failed to preallocate file", filePath);
+    }
+
+    void *mapping =
+        ::mmap(nullptr, capacity, PROT_READ | PROT_WRITE, MAP_SHARED, result.fd_.get(), 0);
+    if (mapping == MAP_FAILED) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to map file",
+                                filePath);
+    }
+    result.data_ = static_cast<std::byte *>(mapping);
+    result.capacity_ = capacity;
+    return result;
+  }
+
+  Result<void, FileError> MappedOutput::sync() {
+    if (!open_) {
+      return alreadyCommitted(path_);
+    }
+    if (data_ != nullptr && ::msync(data_, capacity_, MS_SYNC) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to sync mapping",
+                                path_);
+    }
+    return {};
+  }
+
+  Result<void, FileError> MappedOutput::commit(std::size_t length, bool durable) {
+    if (!open_) {
+      return alreadyCommitted(path_);
+    }
+    if (length > capacity_) {
+      return FileError{
+          .code = FileErrorCode::WriteError,
+          .message = "Committed length exceeds the capacity",
+          .path = path_.string(),
+      };
+    }
+
+    // Truncated while still mapped, so a failure leaves the output as it was
+    if (::ftruncate(fd_.get(), static_cast<off_t>(length)) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to truncate file",
+                                path_);
+    }
+    // Dirty pages stay in the page cache after munmap; the fdatasync below covers them
+    if (data_ != nullptr) {
+      ::munmap(data_, capacity_);
+      data_ = nullptr;
+    }
+    // What is left to commit if the sync or rename below fails and commit() is called again
+    capacity_ = length;
+    if (durable) {
+      if (const int error = GroupCommit::shared().sync(fd_.get()); error != 0) {
+        return fileErrorFromErrno(error, FileErrorCode::WriteError, "Failed to sync file",
+                                  path_);
+      }
+    }
+    if (::rename(temporary_.c_str(), path_.c_str()) != 0) {
+      return fileErrorFromErrno(errno, FileErrorCode::WriteError, "Failed to replace file",
+                                path_);
+    }
+
+    open_ = false;
+    release();
+    if (durable) {
+      // The rename is only durable together with the directory entry
+      auto parent = path_.parent_path();
+      if (parent.empty()) {
+        parent = ".";
+      }
+      const auto directory = FileDescriptor::open(parent, O_RDONLY | O_DIRECTORY);
+      if (!directory) {
+        return fileErrorFromErrno(errno, FileErrorCode::WriteError,
+                                  "Failed to open directory for syncing", parent);
+      }
+      if (const int error = GroupCommit::shared().sync(directory.get(), true); error != 0) {
+        return fileErrorFromErrno(error, FileErrorCode::WriteError, "Failed to sync directory",
+                                  parent);
+      }
+    }
+    return {};
+  }
+
+#endif // _WIN32
+
+} // namespace dotnamecpp::utils
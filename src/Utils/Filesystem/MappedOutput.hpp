@@ -0,0 +1,104 @@
+#pragma once
+
+#include <Utils/UtilsError.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+#ifndef _WIN32
+#include <Utils/Filesystem/FileDescriptor.hpp>
+#endif
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Writable memory mapping of an output file of a known maximum size
+   *
+   * A temporary file next to the target is preallocated to the capacity and mapped shared,
+   * so a producer can serialize straight into the page cache through bytes() instead of
+   * building the content in a heap buffer first. commit() unmaps it, truncates it to the
+   * length actually produced and renames it over the target. An output destroyed without
+   * commit() removes only its temporary file; an existing target keeps its old content. On
+   * Windows the bytes are held in an owned buffer and written out by commit(). Like any
+   * shared mapping, the file must not be truncated by another process while it is being
+   * filled (SIGBUS).
+   */
+  class MappedOutput final {
+  public:
+    MappedOutput() = default;
+    ~MappedOutput();
+
+    MappedOutput(const MappedOutput &) = delete;
+    MappedOutput &operator=(const MappedOutput &) = delete;
+    MappedOutput(MappedOutput &&other) noexcept;
+    MappedOutput &operator=(MappedOutput &&other) noexcept;
+
+    /**
+     * @brief Create a temporary file for filePath and map capacity bytes of it for writing
+     *
+     * The parent directory must exist; filePath itself is left untouched until commit(). The
+     * space is reserved up front, so running out of disk space is reported here rather than by
+     * a fault while writing.
+     *
+     * @param filePath
+     * @param capacity Upper bound of the final file size
+     * @return Result<MappedOutput, FileError>
+     */
+    [[nodiscard]]
+    static Result<MappedOutput, FileError> create(const std::filesystem::path &filePath,
+                                                  std::size_t capacity);
+
+    /**
+     * @brief Writable view of the whole capacity, zero-filled initially
+     *
+     * @return std::span<std::byte>, empty once committed or after a failed commit()
+     */
+    [[nodiscard]]
+    std::span<std::byte> bytes() noexcept {
+      return data_ != nullptr ? std::span<std::byte>(data_, capacity_) : std::span<std::byte>();
+    }
+
+    [[nodiscard]]
+    std::size_t capacity() const noexcept {
+      return capacity_;
+    }
+
+    [[nodiscard]]
+    const std::filesystem::path &path() const noexcept {
+      return path_;
+    }
+
+    /**
+     * @brief Write the bytes produced so far back to the file (msync) without committing
+     *
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> sync();
+
+    /**
+     * @brief Finish the output: truncate it to its final length and move it over the target
+     *
+     * @param length Number of bytes produced, at most capacity()
+     * @param durable Also sync the file and its directory entry before returning
+     * @return Result<void, FileError>
+     */
+    [[nodiscard]]
+    Result<void, FileError> commit(std::size_t length, bool durable = false);
+
+  private:
+    void release() noexcept;
+
+    std::filesystem::path path_;
+    std::filesystem::path temporary_; // Mapped until commit() renames it to path_
+    std::byte *data_ = nullptr;
+    std::size_t capacity_ = 0;
+    bool open_ = false; // Created and neither committed nor released
+    std::vector<std::byte> buffer_; // Used on Windows instead of a mapping
+#ifndef _WIN32
+    FileDescriptor fd_;
+#endif
+  };
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/types.h>
+#endif
+
+namespace dotnamecpp::utils {
+
+  /**
+   * @brief Expected access pattern of a read, passed to the kernel as read-ahead advice
+   *
+   */
+  enum class AccessPattern : std::uint8_t {
+    Normal,     // Kernel default read-ahead
+    Sequential, // Larger read-ahead window
+    Random,     // No read-ahead
+  };
+
+  /**
+   * @brief Page cache hints of a read (posix_fadvise, madvise); ignored where unsupported
+   *
+   */
+  struct ReadHints {
+    AccessPattern pattern = AccessPattern::Normal;
+    // Start loading the whole file into the page cache right away
+    bool willNeed = false;
+    // Drop the file's pages from the page cache once consumed, so a large one-off read does
+    // not push the hot working set out
+    bool dropAfterRead = false;
+  };
+
+#ifndef _WIN32
+
+  /**
+   * @brief Pass the access pattern and read-ahead hints of a descriptor to the kernel
+   *
+   * @param fd
+   * @param hints
+   */
+  inline void adviseDescriptor(int fd, const ReadHints &hints) noexcept {
+#ifdef POSIX_FADV_SEQUENTIAL
+    if (hints.pattern == AccessPattern::Sequential) {
+      ::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+    } else if (hints.pattern == AccessPattern::Random) {
+      ::posix_fadvise(fd, 0, 0, POSIX_FADV_RANDOM);
+    }
+    if (hints.willNeed) {
+      ::posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+    }
+#else
+    (void)fd;
+    (void)hints;
+#endif
+  }
+
+  /**
+   * @brief Drop clean cached pages of a byte range, length 0 meaning up to end of file
+   *
+   * @param fd
+   * @param offset
+   * @param length
+   */
+  inline void dropCachedPages(int fd, off_t offset = 0, off_t length = 0) noexcept {
+#ifdef POSIX_FADV_DONTNEED
+    ::posix_fadvise(fd, offset, length, POSIX_FADV_DONTNEED);
+#else
+    (void)fd;
+    (void)offset;
+    (void)length;
+#endif
+  }
+
+#endif // _WIN32
+
+} // namespace dotnamecpp::utils
@@ -0,0 +1,433 @@
+#pragma once
+
+#include "ILogger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "fmt/format.h"
+
+namespace dotnamecpp::logging {
+
+  // ==========================================================================
+  // Level policies
+  // ==========================================================================
+
+  /**
+   * @brief Level threshold fixed at compile time
+   *
+   * Calls below MinLevel are removed by the compiler, including their formatting.
+   *
+   * @tparam MinLevel
+   */
+  template <Level MinLevel>
+  struct StaticLevel {
+    static constexpr bool kIsStatic = true;
+
+    static constexpr bool enabled(Level level) noexcept { return level >= MinLevel; }
+    [[nodiscard]]
+    static constexpr Level get() noexcept {
+      return MinLevel;
+    }
+    static constexpr void set(Level /*level*/) noexcept {}
+  };
+
+  /**
+   * @brief Level threshold that can be changed at runtime
+   *
+   */
+  class DynamicLevel {
+  public:
+    static constexpr bool kIsStatic = false;
+
+    [[nodiscard]]
+    bool enabled(Level level) const noexcept {
+      return level >= level_.load(std::memory_order_relaxed);
+    }
+    [[nodiscard]]
+    Level get() const noexcept {
+      return level_.load(std::memory_order_relaxed);
+    }
+    void set(Level level) noexcept { level_.store(level, std::memory_order_relaxed); }
+
+  private:
+    std::atomic<Level> level_{Level::LOG_INFO};
+  };
+
+  // ==========================================================================
+  // Sink policies
+  // ==========================================================================
+
+  namespace detail {
+    /**
+     * @brief Format a record as "[prefix][time][LVL][caller] message\n"
+     *
+     */
+    inline void formatRecord(fmt::memory_buffer &out, std::string_view appPrefix, Level level,
+                             std::string_view message, std::string_view caller) {
+      const std::time_t now =
+          std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+      std::tm now_tm{};
+#ifdef _WIN32
+      localtime_s(&now_tm, &now);
+#else
+      localtime_r(&now, &now_tm);
+#endif
+      char timeBuffer[32];
+      const std::size_t timeLength =
+          std::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S", &now_tm);
+
+      auto it = std::back_inserter(out);
+      if (!appPrefix.empty()) {
+        fmt::format_to(it, "[{}]", appPrefix);
+      }
+      fmt::format_to(it, "[{}][{}]", std::string_view(timeBuffer, timeLength), levelTag(level));
+      if (!caller.empty()) {
+        fmt::format_to(it, "[{}]", caller);
+      }
+      fmt::format_to(it, " {}\n", message);
+    }
+  } // namespace detail
+
+  /**
+   * @brief Sink that discards everything; a logger using it compiles to nothing
+   *
+   */
+  struct NullSink {
+    static constexpr bool kEnabled = false;
+
+    void write(Level /*level*/, std::string_view /*message*/, std::string_view /*caller*/) {}
+    void setAppPrefix(std::string_view /*prefix*/) {}
+    [[nodiscard]]
+    std::string getAppPrefix() const {
+      return {};
+    }
+  };
+
+  /**
+   * @brief Base for sinks writing formatted records to a stdio stream
+   *
+   */
+  class StdioSink {
+  public:
+    static constexpr bool kEnabled = true;
+
+    void write(Level level, std::string_view message, std::string_view caller) {
+      fmt::memory_buffer buffer;
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stream_ == nullptr) {
+        return;
+      }
+      detail::formatRecord(buffer, appPrefix_, level, message, caller);
+      std::fwrite(buffer.data(), 1, buffer.size(), stream_);
+    }
+
+    void setAppPrefix(std::string_view prefix) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      appPrefix_ = prefix;
+    }
+
+    [[nodiscard]]
+    std::string getAppPrefix() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return appPrefix_;
+    }
+
+  protected:
+    explicit StdioSink(std::FILE *stream) : stream_(stream) {}
+
+    mutable std::mutex mutex_;
+    std::FILE *stream_;
+    std::string appPrefix_;
+  };
+
+  /**
+   * @brief Sink writing uncolored records to stdout
+   *
+   */
+  class ConsoleSink : public StdioSink {
+  public:
+    ConsoleSink() : StdioSink(stdout) {}
+  };
+
+  /**
+   * @brief Sink appending records to a file
+   *
+   */
+  class FileSink : public StdioSink {
+  public:
+    FileSink() : StdioSink(nullptr) {}
+    ~FileSink() { close(); }
+
+    FileSink(const FileSink &) = delete;
+    FileSink &operator=(const FileSink &) = delete;
+    FileSink(FileSink &&) = delete;
+    FileSink &operator=(FileSink &&) = delete;
+
+    bool open(const std::string &filename) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stream_ != nullptr) {
+        std::fclose(stream_);
+      }
+      stream_ = std::fopen(filename.c_str(), "a");
+      return stream_ != nullptr;
+    }
+
+    void close() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (stream_ != nullptr) {
+        std::fclose(stream_);
+        stream_ = nullptr;
+      }
+    }
+  };
+
+  // ==========================================================================
+  // Logger front end
+  // ==========================================================================
+
+  /**
+   * @brief Header-only logger whose sink and level filter are template policies
+   *
+   * Logging calls are resolved at compile time: there is no virtual dispatch, the sink's write
+   * can be inlined into the caller, statically filtered levels and disabled sinks (NullSink)
+   * compile away completely, and fmt format strings are checked at compile time.
+   * Use LoggerAdapter to pass one where an ILogger is expected.
+   *
+   * @tparam SinkPolicy NullSink, ConsoleSink, FileSink or any type with the same members
+   * @tparam LevelPolicy StaticLevel<L> or DynamicLevel
+   */
+  template <typename SinkPolicy, typename LevelPolicy = DynamicLevel>
+  class BasicLogger {
+  public:
+    using Sink = SinkPolicy;
+    using Levels = LevelPolicy;
+
+    /**
+     * @brief Check whether a record of the given level would be written
+     *
+     * @param level
+     * @return true
+     * @return false
+     */
+    [[nodiscard]]
+    constexpr bool isEnabled(Level level) const noexcept {
+      if constexpr (!SinkPolicy::kEnabled) {
+        return false;
+      } else {
+        return levels_.enabled(level);
+      }
+    }
+
+    /**
+     * @brief Log a message whose level is known at compile time
+     *
+     * @tparam L
+     * @param message
+     * @param caller
+     */
+    template <Level L>
+    void log(std::string_view message, std::string_view caller = {}) {
+      if constexpr (!SinkPolicy::kEnabled) {
+        return;
+      } else if constexpr (LevelPolicy::kIsStatic) {
+        if constexpr (LevelPolicy::enabled(L)) {
+          sink_.write(L, message, caller);
+        }
+      } else {
+        if (levels_.enabled(L)) {
+          sink_.write(L, message, caller);
+        }
+      }
+    }
+
+    /**
+     * @brief Log a message with a runtime level
+     *
+     * @param level
+     * @param message
+     * @param caller
+     */
+    void log(Level level, std::string_view message, std::string_view caller = {}) {
+      if constexpr (SinkPolicy::kEnabled) {
+        if (levels_.enabled(level)) {
+          sink_.write(level, message, caller);
+        }
+      }
+    }
+
+    void debug(std::string_view message, std::string_view caller = {}) {
+      log<Level::LOG_DEBUG>(message, caller);
+    }
+    void info(std::string_view message, std::string_view caller = {}) {
+      log<Level::LOG_INFO>(message, caller);
+    }
+    void warning(std::string_view message, std::string_view caller = {}) {
+      log<Level::LOG_WARNING>(message, caller);
+    }
+    void error(std::string_view message, std::string_view caller = {}) {
+      log<Level::LOG_ERROR>(message, caller);
+    }
+    void critical(std::string_view message, std::string_view caller = {}) {
+      log<Level::LOG_CRITICAL>(message, caller);
+    }
+
+    /**
+     * @brief Format and log a message; nothing is formatted for filtered records
+     *
+     * @tparam L
+     * @tparam Args
+     * @param format
+     * @param args
+     */
+    template <Level L, typename... Args>
+    void logFmt(fmt::format_string<Args...> format, Args &&...args) {
+      if constexpr (SinkPolicy::kEnabled) {
+        if (isEnabled(L)) {
+          fmt::memory_buffer buffer;
+          fmt::format_to(std::back_inserter(buffer), format, std::forward<Args>(args)...);
+          sink_.write(L, std::string_view(buffer.data(), buffer.size()), {});
+        }
+      }
+    }
+
+    template <typename... Args>
+    void debugFmt(fmt::format_string<Args...> format, Args &&...args) {
+      logFmt<Level::LOG_DEBUG>(format, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    void infoFmt(fmt::format_string<Args...> format, Args &&...args) {
+      logFmt<Level::LOG_INFO>(format, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    void warningFmt(fmt::format_string<Args...> format, Args &&...args) {
+      logFmt<Level::LOG_WARNING>(format, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    void errorFmt(fmt::format_string<Args...> format, Args &&...args) {
+      logFmt<Level::LOG_ERROR>(format, std::forward<Args>(args)...);
+    }
+    template <typename... Args>
+    void criticalFmt(fmt::format_string<Args...> format, Args &&...args) {
+      logFmt<Level::LOG_CRITICAL>(format, std::forward<Args>(args)...);
+    }
+
+    void setLevel(Level level) { levels_.set(level); }
+    [[nodiscard]]
+    Level getLevel() const {
+      return levels_.get();
+    }
+
+    [[nodiscard]]
+    SinkPolicy &sink() noexcept {
+      return sink_;
+    }
+    [[nodiscard]]
+    const SinkPolicy &sink() const noexcept {
+      return sink_;
+    }
+
+  private:
+    SinkPolicy sink_;
+    LevelPolicy levels_;
+  };
+
+  using NullBasicLogger = BasicLogger<NullSink, StaticLevel<Level::LOG_CRITICAL>>;
+  using ConsoleBasicLogger = BasicLogger<ConsoleSink, DynamicLevel>;
+  using FileBasicLogger = BasicLogger<FileSink, DynamicLevel>;
+
+  // ==========================================================================
+  // ILogger adapter
+  // ==========================================================================
+
+  /**
+   * @brief Exposes a BasicLogger through the ILogger interface
+   *
+   * Keeps policy-based loggers usable wherever the library expects std::shared_ptr<ILogger>,
+   * e.g. DotNameLib or UtilsFactory::ApplicationContext::logger.
+   *
+   * @tparam Logger A BasicLogger instantiation
+   */
+  template <typename Logger>
+  class LoggerAdapter final : public ILogger {
+  public:
+    LoggerAdapter() = default;
+
+    void debug(const std::string &message, const std::string &caller = "") override {
+      logger_.debug(message, caller);
+    }
+    void info(const std::string &message, const std::string &caller = "") override {
+      logger_.info(message, caller);
+    }
+    void warning(const std::string &message, const std::string &caller = "") override {
+      logger_.warning(message, caller);
+    }
+    void error(const std::string &message, const std::string &caller = "") override {
+      logger_.error(message, caller);
+    }
+    void critical(const std::string &message, const std::string &caller = "") override {
+      logger_.critical(message, caller);
+    }
+
+#if __cplusplus >= 202002L
+    void logAt(Level level, const std::string &message, CallSiteId site) override {
+      if (logger_.isEnabled(level)) {
+        logger_.log(level, message, CallSiteRegistry::format(site));
+      }
+    }
+#endif
+
+    void setLevel(Level level) override { logger_.setLevel(level); }
+    [[nodiscard]]
+    Level getLevel() const override {
+      return logger_.getLevel();
+    }
+
+    void setAppPrefix(const std::string &prefix) override { logger_.sink().setAppPrefix(prefix); }
+    [[nodiscard]]
+    std::string getAppPrefix() const override {
+      return logger_.sink().getAppPrefix();
+    }
+
+    bool enableFileLogging(const std::string &filename) override {
+      if constexpr (requires(typename Logger::Sink &sink) { sink.open(filename); }) {
+        return logger_.sink().open(filename);
+      } else {
+        return false;
+      }
+    }
+
+    void disableFileLogging() override {
+      if constexpr (requires(typename Logger::Sink &sink) { sink.close(); }) {
+        logger_.sink().close();
+      }
+    }
+
+    [[nodiscard]]
+    Logger &logger() noexcept {
+      return logger_;
+    }
+
+  private:
+    Logger logger_;
+  };
+
+  /**
+   * @brief Create an ILogger adapter around a new BasicLogger
+   *
+   * @tparam Logger A BasicLogger instantiation
+   * @return std::shared_ptr<LoggerAdapter<Logger>>
+   */
+  template <typename Logger>
+  std::shared_ptr<LoggerAdapter<Logger>> makeLoggerAdapter() {
+    return std::make_shared<LoggerAdapter<Logger>>();
+  }
+
+} // namespace dotnamecpp::logging
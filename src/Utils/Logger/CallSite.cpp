@@ -0,0 +1,111 @@
+#include "CallSite.hpp"
+#include <array>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace dotnamecpp::logging {
+
+  namespace {
+
+    // file_name()/function_name() point to string literals, so pointer identity plus line and
+    // column identify a call site without touching the strings
+    struct SiteKey {
+      const char *file;
+      const char *function;
+      std::uint32_t line;
+      std::uint32_t column;
+
+      bool operator==(const SiteKey &other) const = default;
+    };
+
+    struct SiteKeyHash {
+      std::size_t operator()(const SiteKey &key) const noexcept {
+        std::size_t hash = std::hash<const void *>{}(key.file);
+        hash ^= std::hash<const void *>{}(key.function) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        hash ^= (static_cast<std::size_t>(key.line) << 16) ^ key.column;
+        return hash;
+      }
+    };
+
+    struct Registry {
+      std::shared_mutex mutex;
+      std::unordered_map<SiteKey, CallSiteId, SiteKeyHash> ids;
+      std::deque<CallSite> sites;
+    };
+
+    Registry &registry() {
+      static Registry instance;
+      return instance;
+    }
+
+    struct CacheEntry {
+      SiteKey key{nullptr, nullptr, 0, 0};
+      CallSiteId id = 0;
+    };
+
+    constexpr std::size_t kThreadCacheSize = 64;
+
+    std::string_view baseName(const char *path) {
+      std::string_view view(path);
+      const auto slash = view.find_last_of("/\\");
+      return slash == std::string_view::npos ? view : view.substr(slash + 1);
+    }
+
+  } // namespace
+
+  CallSiteId CallSiteRegistry::intern(const std::source_location &location) {
+    const SiteKey key{location.file_name(), location.function_name(), location.line(),
+                      location.column()};
+
+    thread_local std::array<CacheEntry, kThreadCacheSize> cache{};
+    auto &slot = cache[SiteKeyHash{}(key) % kThreadCacheSize];
+    if (slot.key == key) {
+      return slot.id;
+    }
+
+    auto &reg = registry();
+    {
+      std::shared_lock<std::shared_mutex> lock(reg.mutex);
+      if (auto it = reg.ids.find(key); it != reg.ids.end()) {
+        slot = CacheEntry{.key = key, .id = it->second};
+        return it->second;
+      }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(reg.mutex);
+    auto [it, inserted] = reg.ids.try_emplace(key, static_cast<CallSiteId>(reg.sites.size()));
+    if (inserted) {
+      reg.sites.push_back(CallSite{.file = key.file,
+                                   .function = key.function,
+                                   .line = key.line,
+                                   .fileName = baseName(key.file)});
+    }
+    slot = CacheEntry{.key = key, .id = it->second};
+    return it->second;
+  }
+
+  CallSite CallSiteRegistry::get(CallSiteId id) {
+    auto &reg = registry();
+    std::shared_lock<std::shared_mutex> lock(reg.mutex);
+    return id < reg.sites.size() ? reg.sites[id] : CallSite{};
+  }
+
+  std::string CallSiteRegistry::format(CallSiteId id) {
+    const CallSite site = get(id);
+    std::string result(site.fileName);
+    result += ':';
+    result += std::to_string(site.line);
+    return result;
+  }
+
+  std::size_t CallSiteRegistry::size() {
+    auto &reg = registry();
+    std::shared_lock<std::shared_mutex> lock(reg.mutex);
+    return reg.sites.size();
+  }
+
+} // namespace dotnamecpp::logging
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <source_location>
+#include <string>
+#include <string_view>
+
+namespace dotnamecpp::logging {
+
+  /**
+   * @brief Compact identifier of an interned logging call site
+   *
+   */
+  using CallSiteId = std::uint32_t;
+
+  /**
+   * @brief Source location metadata stored once per call site
+   *
+   */
+  struct CallSite {
+    const char *file = "";
+    const char *function = "";
+    std::uint32_t line = 0;
+    std::string_view fileName; // file without directories, points into file
+  };
+
+  /**
+   * @brief Process-wide table of logging call sites
+   *
+   * Each std::source_location is registered once and referred to by its CallSiteId afterwards,
+   * so location-rich records carry a 32-bit ID instead of formatted file/function/line strings.
+   * Lookups of already known sites go through a small per-thread cache first and never
+   * allocate.
+   */
+  class CallSiteRegistry {
+  public:
+    /**
+     * @brief Get the ID of a call site, registering it on first use
+     *
+     * @param location
+     * @return CallSiteId
+     */
+    static CallSiteId intern(const std::source_location &location);
+
+    /**
+     * @brief Get the metadata of an interned call site
+     *
+     * @param id
+     * @return CallSite, default constructed for unknown IDs
+     */
+    [[nodiscard]]
+    static CallSite get(CallSiteId id);
+
+    /**
+     * @brief Render a call site as a short "file:line" string
+     *
+     * @param id
+     * @return std::string
+     */
+    [[nodiscard]]
+    static std::string format(CallSiteId id);
+
+    /**
+     * @brief Number of registered call sites
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    static std::size_t size();
+  };
+
+} // namespace dotnamecpp::logging
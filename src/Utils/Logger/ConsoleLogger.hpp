@@ -2,8 +2,12 @@
 #define CONSOLELOGGER_HPP
 
 #include "ILogger.hpp"
+#include "MappedLogFile.hpp"
 
+#include <array>
 #include <chrono>
+#include <cstdio>
+#include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -11,9 +15,10 @@
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <utility>
 
-#include "fmt/core.h"
+#include "fmt/format.h"
 
 #ifdef _WIN32
 #include <Utils/Platform/WindowsHeaders.hpp>
@@ -21,6 +26,7 @@
 #define isatty _isatty
 #define fileno _fileno
 #else
+#include <cerrno>
 #include <unistd.h>
 #endif
 
@@ -28,6 +34,7 @@ class ConsoleLogger : public dotnamecpp::logging::ILogger {
 private:
   std::mutex logMutex_;
   std::ofstream logFile_;
+  std::shared_ptr<dotnamecpp::logging::MappedLogFile> mappedLogFile_;
   bool addNewLine_ = true;
   std::string appPrefix_;
 
@@ -43,6 +50,14 @@ private:
 
   bool colorEnabled_ = true;    // User can override
   bool autoDetectColor_ = true; // Auto-detect TTY support
+  bool stdoutIsTty_ = detectTerminal(); // Detected once, not per record
+  std::string recordBuffer_;            // Reused for every record, guarded by logMutex_
+
+#ifndef _WIN32
+  static constexpr std::array<std::string_view, 5> kUnixColors = {
+      "\033[34m", "\033[32m", "\033[33m", "\033[31m", "\033[95m"};
+  static constexpr std::string_view kUnixReset = "\033[0m";
+#endif
 
 public:
   ConsoleLogger() = default;
@@ -56,9 +71,11 @@ public:
   ConsoleLogger(const ConsoleLogger &) = delete;
   ConsoleLogger &operator=(const ConsoleLogger &) = delete;
   ConsoleLogger(ConsoleLogger &&other) noexcept
-      : logFile_(std::move(other.logFile_)), addNewLine_(other.addNewLine_),
-        appPrefix_(std::move(other.appPrefix_)), currentLevel_(other.currentLevel_),
-        colorEnabled_(other.colorEnabled_), autoDetectColor_(other.autoDetectColor_) {}
+      : logFile_(std::move(other.logFile_)), mappedLogFile_(std::move(other.mappedLogFile_)),
+        addNewLine_(other.addNewLine_), appPrefix_(std::move(other.appPrefix_)),
+        currentLevel_(other.currentLevel_),
+        colorEnabled_(other.colorEnabled_), autoDetectColor_(other.autoDetectColor_),
+        stdoutIsTty_(other.stdoutIsTty_) {}
 
   ConsoleLogger &operator=(ConsoleLogger &&other) noexcept {
     if (this != &other) {
@@ -68,11 +85,13 @@ public:
       std::lock_guard<std::mutex> lock2(other.logMutex_, std::adopt_lock);
 
       logFile_ = std::move(other.logFile_);
+      mappedLogFile_ = std::move(other.mappedLogFile_);
       addNewLine_ = other.addNewLine_;
       appPrefix_ = std::move(other.appPrefix_);
       currentLevel_ = other.currentLevel_;
       colorEnabled_ = other.colorEnabled_;
       autoDetectColor_ = other.autoDetectColor_;
+      stdoutIsTty_ = other.stdoutIsTty_;
     }
     return *this;
   }
@@ -119,40 +138,65 @@ public:
 #else
     localtime_r(&now_c, &now_tm);
 #endif
-
-    // Create log header
-    std::ostringstream header;
+    char timeBuffer[32];
+    const std::size_t timeLength =
+        std::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S", &now_tm);
+
+    const bool useColors = shouldUseColors();
+
+    // Build the whole record, including colour escapes, in one reused buffer
+    recordBuffer_.clear();
+    auto out = std::back_inserter(recordBuffer_);
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    if (useColors) {
+      recordBuffer_ += kUnixColors[static_cast<std::size_t>(level)];
+    }
+#endif
+    const std::size_t recordStart = recordBuffer_.size();
     if (!appPrefix_.empty()) {
-      header << "[" << appPrefix_ << "]";
+      fmt::format_to(out, "[{}]", appPrefix_);
     }
-    header << "[" << std::put_time(&now_tm, "%Y-%m-%d %H:%M:%S") << "]";
-    header << "[" << levelToString(level) << "]";
+    fmt::format_to(out, "[{}][{}]", std::string_view(timeBuffer, timeLength),
+                   dotnamecpp::logging::levelTag(level));
     if (!caller.empty()) {
-      header << "[" << caller << "]";
+      fmt::format_to(out, "[{}]", caller);
     }
-    header << " ";
+    recordBuffer_ += ' ';
+    recordBuffer_ += message;
+    if (addNewLine_) {
+      recordBuffer_ += '\n';
+    }
+    const std::size_t recordLength = recordBuffer_.size() - recordStart;
 
     // Log to console
-    if (shouldUseColors()) {
-      setConsoleColor(level);
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+    if (useColors) {
+      recordBuffer_ += kUnixReset;
     }
-    std::cout << header.str() << message;
-    if (addNewLine_) {
-      std::cout << "\n";
+    writeToStdout(recordBuffer_);
+#endif
+    const std::string_view record =
+        std::string_view(recordBuffer_).substr(recordStart, recordLength);
+#if defined(_WIN32) || defined(__EMSCRIPTEN__)
+    if (useColors) {
+      setConsoleColor(level);
     }
-
-    if (shouldUseColors()) {
+    std::cout << record;
+    if (useColors) {
       resetConsoleColor();
     }
+#endif
 
     // Log to file if enabled
     if (logFile_.is_open()) {
-      logFile_ << header.str() << message;
-      if (addNewLine_) {
-        logFile_ << "\n";
-      }
+      logFile_ << record;
       logFile_.flush(); // Force immediate write to disk
     }
+
+    // Log to mapped file if enabled - a range reservation and a memcpy from the reused buffer
+    if (mappedLogFile_) {
+      mappedLogFile_->append(record);
+    }
   };
 
   void setLevel(dotnamecpp::logging::Level level) override {
@@ -197,8 +241,37 @@ public:
     if (logFile_.is_open()) {
       logFile_.close();
     }
+    mappedLogFile_.reset();
   };
 
+  /**
+   * @brief Enable logging to memory-mapped, preallocated log segments
+   *
+   * Intended for high-rate audit logs: records are copied into the mapping without a syscall
+   * per line and made durable by a periodic msync. Segments are named
+   * `<stem>.<index><ext>` next to basePath.
+   *
+   * @param basePath
+   * @param segmentSize Bytes preallocated per segment
+   * @param syncInterval msync period
+   * @return true
+   * @return false if mapped files are not supported or the first segment could not be created
+   */
+  bool enableMappedFileLogging(const std::string &basePath,
+                               std::size_t segmentSize =
+                                   dotnamecpp::logging::MappedLogFile::kDefaultSegmentSize,
+                               std::chrono::milliseconds syncInterval =
+                                   dotnamecpp::logging::MappedLogFile::kDefaultSyncInterval) {
+    auto mappedLogFile = std::make_shared<dotnamecpp::logging::MappedLogFile>();
+    if (!mappedLogFile->open(basePath, segmentSize, syncInterval)) {
+      std::cerr << "Failed to open mapped log file: " << basePath << "\n";
+      return false;
+    }
+    std::lock_guard<std::mutex> lock(logMutex_);
+    mappedLogFile_ = std::move(mappedLogFile);
+    return true;
+  }
+
   /**
    * @brief Convert a logging level to its string representation
    *
@@ -206,14 +279,7 @@ public:
    * @return std::string
    */
   static std::string levelToString(dotnamecpp::logging::Level level) {
-    switch (level) {
-    case dotnamecpp::logging::Level::LOG_DEBUG: return "DBG";
-    case dotnamecpp::logging::Level::LOG_INFO: return "INF";
-    case dotnamecpp::logging::Level::LOG_WARNING: return "WRN";
-    case dotnamecpp::logging::Level::LOG_ERROR: return "ERR";
-    case dotnamecpp::logging::Level::LOG_CRITICAL: return "CRI";
-    default: return "INF";
-    }
+    return std::string(dotnamecpp::logging::levelTag(level));
   }
 
   /**
@@ -227,7 +293,7 @@ public:
 #elif defined(__EMSCRIPTEN__)
 // no colors, no reset
 #else
-    std::cout << "\033[0m";
+    std::cout << kUnixReset;
 #endif
   }
 
@@ -251,15 +317,9 @@ public:
   }
 #else
   static void setConsoleColorUnix(dotnamecpp::logging::Level level) {
-    static const std::map<dotnamecpp::logging::Level, const char *> colorMap = {
-        {dotnamecpp::logging::Level::LOG_DEBUG, "\033[34m"},
-        {dotnamecpp::logging::Level::LOG_INFO, "\033[32m"},
-        {dotnamecpp::logging::Level::LOG_WARNING, "\033[33m"},
-        {dotnamecpp::logging::Level::LOG_ERROR, "\033[31m"},
-        {dotnamecpp::logging::Level::LOG_CRITICAL, "\033[95m"}};
-    auto it = colorMap.find(level);
-    if (it != colorMap.end()) {
-      std::cout << it->second;
+    const auto index = static_cast<std::size_t>(level);
+    if (index < kUnixColors.size()) {
+      std::cout << kUnixColors[index];
     } else {
       resetConsoleColor();
     }
@@ -446,13 +506,49 @@ private:
     if (!autoDetectColor_) {
       return colorEnabled_;
     }
-    // Auto-detect: check if stdout is a TTY
+    // Auto-detect: use the TTY check done at construction
+    return colorEnabled_ && stdoutIsTty_;
+  }
+
+  /**
+   * @brief Check once whether stdout is a terminal
+   *
+   * @return true if stdout is a TTY, false otherwise
+   */
+  static bool detectTerminal() {
 #ifdef __EMSCRIPTEN__
     return false; // No color support in Emscripten
 #else
-    return colorEnabled_ && (isatty(fileno(stdout)) != 0);
+    return isatty(fileno(stdout)) != 0;
 #endif
   }
+
+#if !defined(_WIN32) && !defined(__EMSCRIPTEN__)
+  /**
+   * @brief Write a complete record to fd 1 with as few syscalls as possible
+   *
+   * Bypasses std::cout and its stdio synchronisation; a record shorter than PIPE_BUF is
+   * written atomically with respect to other processes sharing the pipe. Output the program
+   * still holds in the std::cout or stdio buffers is flushed first, so records keep their
+   * place relative to it (a no-op without any buffered output).
+   *
+   * @param data
+   */
+  static void writeToStdout(std::string_view data) {
+    std::cout.flush();
+    std::fflush(stdout);
+    while (!data.empty()) {
+      const ssize_t written = ::write(STDOUT_FILENO, data.data(), data.size());
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return;
+      }
+      data.remove_prefix(static_cast<std::size_t>(written));
+    }
+  }
+#endif
 }; // class ConsoleLogger
 
 #endif
\ No newline at end of file
@@ -6,9 +6,11 @@
 #include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 // Include source_location for C++20 and later
 #if __cplusplus >= 202002L
+#include "CallSite.hpp"
 #include <source_location>
 #endif
 
@@ -20,6 +22,23 @@ namespace dotnamecpp::logging {
    */
   enum class Level : std::uint8_t { LOG_DEBUG, LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_CRITICAL };
 
+  /**
+   * @brief Short three-letter tag of a logging level as shown in record headers
+   *
+   * @param level
+   * @return std::string_view
+   */
+  constexpr std::string_view levelTag(Level level) noexcept {
+    switch (level) {
+    case Level::LOG_DEBUG: return "DBG";
+    case Level::LOG_INFO: return "INF";
+    case Level::LOG_WARNING: return "WRN";
+    case Level::LOG_ERROR: return "ERR";
+    case Level::LOG_CRITICAL: return "CRI";
+    default: return "INF";
+    }
+  }
+
   /**
    * @brief Interface for a logger
    */
@@ -27,11 +46,20 @@ namespace dotnamecpp::logging {
 
   /**
    * @brief Helper class for streaming log messages
+   *
+   * A LogStream is a temporary that lives until the end of the logging statement, so it refers
+   * to its logger without taking ownership (no reference count traffic per record).
+   *
+   * Lifetime: the logger must outlive the stream, whose destructor writes the record. A
+   * LogStream kept in a variable, member or container, or returned from a function, dangles
+   * once its logger is destroyed. Earlier versions held a std::shared_ptr to the logger and
+   * kept it alive; code relying on that must hold its own shared_ptr for as long as the
+   * stream exists.
    */
   class LogStream {
   public:
-    LogStream(std::shared_ptr<ILogger> logger, Level level, std::string caller)
-        : logger_(std::move(logger)), level_(level), caller_(std::move(caller)) {}
+    LogStream(ILogger &logger, Level level, std::string caller)
+        : logger_(logger), level_(level), caller_(std::move(caller)) {}
 
     ~LogStream();
 
@@ -60,7 +88,7 @@ namespace dotnamecpp::logging {
     }
 
   private:
-    std::shared_ptr<ILogger> logger_;
+    ILogger &logger_;
     Level level_;
     std::string caller_;
     std::ostringstream oss_;
@@ -155,15 +183,40 @@ namespace dotnamecpp::logging {
      */
     virtual void disableFileLogging() = 0;
 
+#if __cplusplus >= 202002L
+    /**
+     * @brief Log a message attributed to an interned call site
+     *
+     * The location is only rendered here, as a short "file:line" caller. Loggers that drop
+     * the record (or keep the ID, e.g. for a structured sink) never pay for formatting it.
+     *
+     * @param level
+     * @param message
+     * @param site ID from CallSiteRegistry::intern()
+     */
+    virtual void logAt(Level level, const std::string &message, CallSiteId site) {
+      const std::string caller = CallSiteRegistry::format(site);
+      switch (level) {
+      case Level::LOG_DEBUG: debug(message, caller); break;
+      case Level::LOG_INFO: info(message, caller); break;
+      case Level::LOG_WARNING: warning(message, caller); break;
+      case Level::LOG_ERROR: error(message, caller); break;
+      case Level::LOG_CRITICAL: critical(message, caller); break;
+      }
+    }
+#endif
+
     /**
      * @brief Create a LogStream for streaming log messages
      *
+     * The stream refers to this logger without owning it, see LogStream.
+     *
      * @param level
      * @param caller
      * @return LogStream
      */
     LogStream stream(Level level, const std::string &caller = "") {
-      return LogStream{shared_from_this(), level, caller};
+      return LogStream{*this, level, caller};
     }
 
     // Convenience methods for each log level
@@ -278,10 +331,7 @@ namespace dotnamecpp::logging {
      */
     void debugWithLocation(const std::string &message,
                            const std::source_location &location = std::source_location::current()) {
-      debugStream() << "Log: " << message << "\n"
-                    << "File: " << location.file_name() << "\n"
-                    << "Function: " << location.function_name() << "\n"
-                    << "Line: " << location.line() << "\n";
+      logAt(Level::LOG_DEBUG, message, CallSiteRegistry::intern(location));
     }
 
     /**
@@ -292,10 +342,7 @@ namespace dotnamecpp::logging {
      */
     void infoWithLocation(const std::string &message,
                           const std::source_location &location = std::source_location::current()) {
-      infoStream() << "Log: " << message << "\n"
-                   << "File: " << location.file_name() << "\n"
-                   << "Function: " << location.function_name() << "\n"
-                   << "Line: " << location.line() << "\n";
+      logAt(Level::LOG_INFO, message, CallSiteRegistry::intern(location));
     }
 
     /**
@@ -306,10 +353,7 @@ namespace dotnamecpp::logging {
      */
     void warningWithLocation(const std::string &message, const std::source_location &location =
                                                              std::source_location::current()) {
-      warningStream() << "Log: " << message << "\n"
-                      << "File: " << location.file_name() << "\n"
-                      << "Function: " << location.function_name() << "\n"
-                      << "Line: " << location.line() << "\n";
+      logAt(Level::LOG_WARNING, message, CallSiteRegistry::intern(location));
     }
 
     /**
@@ -320,10 +364,7 @@ namespace dotnamecpp::logging {
      */
     void errorWithLocation(const std::string &message,
                            const std::source_location &location = std::source_location::current()) {
-      errorStream() << "Log: " << message << "\n"
-                    << "File: " << location.file_name() << "\n"
-                    << "Function: " << location.function_name() << "\n"
-                    << "Line: " << location.line() << "\n";
+      logAt(Level::LOG_ERROR, message, CallSiteRegistry::intern(location));
     }
 
     /**
@@ -334,10 +375,7 @@ namespace dotnamecpp::logging {
      */
     void criticalWithLocation(const std::string &message, const std::source_location &location =
                                                               std::source_location::current()) {
-      criticalStream() << "Log: " << message << "\n"
-                       << "File: " << location.file_name() << "\n"
-                       << "Function: " << location.function_name() << "\n"
-                       << "Line: " << location.line() << "\n";
+      logAt(Level::LOG_CRITICAL, message, CallSiteRegistry::intern(location));
     }
 #endif
   };
@@ -349,11 +387,11 @@ namespace dotnamecpp::logging {
   inline LogStream::~LogStream() {
     const std::string message = oss_.str();
     switch (level_) {
-    case Level::LOG_DEBUG: logger_->debug(message, caller_); break;
-    case Level::LOG_INFO: logger_->info(message, caller_); break;
-    case Level::LOG_WARNING: logger_->warning(message, caller_); break;
-    case Level::LOG_ERROR: logger_->error(message, caller_); break;
-    case Level::LOG_CRITICAL: logger_->critical(message, caller_); break;
+    case Level::LOG_DEBUG: logger_.debug(message, caller_); break;
+    case Level::LOG_INFO: logger_.info(message, caller_); break;
+    case Level::LOG_WARNING: logger_.warning(message, caller_); break;
+    case Level::LOG_ERROR: logger_.error(message, caller_); break;
+    case Level::LOG_CRITICAL: logger_.critical(message, caller_); break;
     }
   }
 
@@ -1,6 +1,7 @@
 #include "LoggerFactory.hpp"
 #include "ConsoleLogger.hpp"
 #include "NullLogger.hpp"
+#include "UnixSocketLogger.hpp"
 
 namespace dotnamecpp::logging {
 
@@ -9,6 +10,7 @@ namespace dotnamecpp::logging {
     switch (type) {
     case LoggerType::Console: return createConsole(config);
     case LoggerType::Null: return createNull();
+    case LoggerType::UnixSocket: return createUnixSocket(config);
     default: return createConsole(config);
     }
   }
@@ -30,4 +32,20 @@ namespace dotnamecpp::logging {
 
   std::shared_ptr<ILogger> LoggerFactory::createNull() { return std::make_shared<NullLogger>(); }
 
+  std::shared_ptr<ILogger> LoggerFactory::createUnixSocket(const LoggerConfig &config) {
+#ifdef _WIN32
+    return createConsole(config);
+#else
+    auto logger = std::make_shared<UnixSocketLogger>(config.socketPath, config.socketBatchSize,
+                                                     config.socketQueueCapacity);
+    logger->setLevel(config.level);
+
+    if (!config.appPrefix.empty()) {
+      logger->setAppPrefix(config.appPrefix);
+    }
+
+    return logger;
+#endif
+  }
+
 } // namespace dotnamecpp::logging
\ No newline at end of file
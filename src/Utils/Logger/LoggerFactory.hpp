@@ -1,11 +1,12 @@
 #pragma once
 #include "Utils/Logger/ILogger.hpp"
+#include <cstddef>
 #include <memory>
 #include <string>
 
 namespace dotnamecpp::logging {
 
-  enum class LoggerType : uint8_t { Console, File, Null };
+  enum class LoggerType : uint8_t { Console, File, Null, UnixSocket };
 
   /**
    * @brief Configuration options for creating a logger
@@ -16,6 +17,9 @@ namespace dotnamecpp::logging {
     std::string logFilePath;
     bool colorOutput = true;
     std::string appPrefix;
+    std::string socketPath;           // UnixSocket: path of the collector's datagram socket
+    std::size_t socketBatchSize = 16; // UnixSocket: maximum records per datagram
+    std::size_t socketQueueCapacity = 1024; // UnixSocket: records kept while collector is down
   };
 
   class LoggerFactory {
@@ -23,7 +27,7 @@ namespace dotnamecpp::logging {
     /**
      * @brief Create a logger instance based on the specified type and configuration
      *
-     * @param type The type of logger to create (Console, File, Null)
+     * @param type The type of logger to create (Console, File, Null, UnixSocket)
      * @param config Configuration options for the logger
      * @return std::shared_ptr<ILogger>
      */
@@ -52,6 +56,16 @@ namespace dotnamecpp::logging {
      * @return std::shared_ptr<ILogger>
      */
     static std::shared_ptr<ILogger> createNull();
+
+    /**
+     * @brief Create a Unix domain socket logger shipping records to a local collector
+     *
+     * Falls back to a console logger on platforms without AF_UNIX datagram sockets.
+     *
+     * @param config
+     * @return std::shared_ptr<ILogger>
+     */
+    static std::shared_ptr<ILogger> createUnixSocket(const LoggerConfig &config = LoggerConfig{});
   };
 
 } // namespace dotnamecpp::logging
\ No newline at end of file
@@ -0,0 +1,312 @@
+#include "MappedLogFile.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fmt/core.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace dotnamecpp::logging {
+
+  MappedLogFile::~MappedLogFile() { close(); }
+
+#ifdef _WIN32
+
+  bool MappedLogFile::open(const std::filesystem::path & /*basePath*/,
+                           std::size_t /*segmentSize*/,
+                           std::chrono::milliseconds /*syncInterval*/) {
+    return false;
+  }
+
+  void MappedLogFile::close() {}
+
+  bool MappedLogFile::append(std::string_view /*record*/) { return false; }
+
+  void MappedLogFile::sync() {}
+
+  std::filesystem::path MappedLogFile::currentSegmentPath() const { return {}; }
+
+  std::unique_ptr<MappedLogFile::Segment>
+  MappedLogFile::createSegment(std::size_t /*minCapacity*/) {
+    return nullptr;
+  }
+
+  std::size_t MappedLogFile::liveSegmentCount() const { return 0; }
+
+  bool MappedLogFile::rollOver(std::uint64_t /*fullIndex*/, std::size_t /*recordSize*/) {
+    return false;
+  }
+
+  void MappedLogFile::finalizeRetired(bool /*wait*/) {}
+
+  void MappedLogFile::freeFinalized() {}
+
+  void MappedLogFile::finalizeSegment(Segment & /*segment*/) {}
+
+  void MappedLogFile::syncLoop() {}
+
+#else
+
+  bool MappedLogFile::open(const std::filesystem::path &basePath, std::size_t segmentSize,
+                           std::chrono::milliseconds syncInterval) {
+    close();
+
+    std::lock_guard<std::mutex> lock(rollMutex_);
+    basePath_ = basePath;
+    segmentSize_ = std::max<std::size_t>(segmentSize, static_cast<std::size_t>(::getpagesize()));
+    syncInterval_ = syncInterval;
+    nextIndex_ = 0;
+
+    auto segment = createSegment(segmentSize_);
+    if (!segment) {
+      return false;
+    }
+    current_.store(segment.get(), std::memory_order_release);
+    segments_.push_back(std::move(segment));
+
+    if (syncInterval_.count() > 0) {
+      stopSync_ = false;
+      syncThread_ = std::thread(&MappedLogFile::syncLoop, this);
+    }
+    return true;
+  }
+
+  void MappedLogFile::close() {
+    if (syncThread_.joinable()) {
+      {
+        std::lock_guard<std::mutex> lock(syncMutex_);
+        stopSync_ = true;
+      }
+      syncCv_.notify_all();
+      syncThread_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(rollMutex_);
+    Segment *active = current_.exchange(nullptr, std::memory_order_acq_rel);
+    if (active != nullptr) {
+      retired_.push_back(active);
+    }
+    finalizeRetired(true);
+    segments_.clear();
+  }
+
+  bool MappedLogFile::append(std::string_view record) {
+    const std::size_t size = record.size();
+    if (size == 0) {
+      return isOpen();
+    }
+
+    for (;;) {
+      // Announce the writer before re-checking the segment, so finalization never unmaps a
+      // segment that is still being written to, nor frees one this thread can still reach
+      entering_.fetch_add(1, std::memory_order_seq_cst);
+      Segment *segment = current_.load(std::memory_order_seq_cst);
+      if (segment == nullptr) {
+        entering_.fetch_sub(1, std::memory_order_seq_cst);
+        return false;
+      }
+      segment->writers.fetch_add(1, std::memory_order_seq_cst);
+      entering_.fetch_sub(1, std::memory_order_seq_cst);
+      if (current_.load(std::memory_order_seq_cst) != segment) {
+        segment->writers.fetch_sub(1, std::memory_order_release);
+        continue;
+      }
+
+      const std::size_t offset = segment->tail.fetch_add(size, std::memory_order_relaxed);
+      if (offset + size <= segment->capacity) {
+        std::memcpy(segment->base + offset, record.data(), size);
+        segment->writers.fetch_sub(1, std::memory_order_release);
+        return true;
+      }
+
+      // Reservations are monotonic: exactly one writer straddles the end of the segment and
+      // its offset is the number of valid bytes in it
+      if (offset <= segment->capacity) {
+        segment->sealedAt.store(offset, std::memory_order_release);
+      }
+      // The segment may be freed once released, so only its index is used afterwards
+      const std::uint64_t index = segment->index;
+      segment->writers.fetch_sub(1, std::memory_order_release);
+
+      if (!rollOver(index, size)) {
+        return false;
+      }
+    }
+  }
+
+  void MappedLogFile::sync() {
+    std::lock_guard<std::mutex> lock(rollMutex_);
+    Segment *segment = current_.load(std::memory_order_acquire);
+    if (segment != nullptr) {
+      ::msync(segment->base, segment->capacity, MS_SYNC);
+    }
+  }
+
+  std::filesystem::path MappedLogFile::currentSegmentPath() const {
+    std::lock_guard<std::mutex> lock(rollMutex_);
+    Segment *segment = current_.load(std::memory_order_acquire);
+    return segment != nullptr ? segment->path : std::filesystem::path{};
+  }
+
+  std::size_t MappedLogFile::liveSegmentCount() const {
+    std::lock_guard<std::mutex> lock(rollMutex_);
+    return segments_.size();
+  }
+
+  std::unique_ptr<MappedLogFile::Segment> MappedLogFile::createSegment(std::size_t minCapacity) {
+    auto segment = std::make_unique<Segment>();
+    segment->capacity = std::max(segmentSize_, minCapacity);
+
+    // Never overwrite segments left over from a previous run
+    std::error_code ec;
+    do {
+      segment->index = nextIndex_;
+      segment->path = basePath_.parent_path() /
+                      fmt::format("{}.{:06}{}", basePath_.stem().string(), nextIndex_++,
+                                  basePath_.extension().string());
+    } while (std::filesystem::exists(segment->path, ec));
+
+    segment->fd = ::open(segment->path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (segment->fd < 0) {
+      return nullptr;
+    }
+
+    // Reserve the blocks up front so a full disk fails here instead of with SIGBUS on a store
+#ifdef __linux__
+    const bool allocated =
+        ::posix_fallocate(segment->fd, 0, static_cast<off_t>(segment->capacity)) == 0;
+#else
+    const bool allocated = ::ftruncate(segment->fd, static_cast<off_t>(segment->capacity)) == 0;
+#endif
+    if (allocated) {
+      void *mapping =
+          ::mmap(nullptr, segment->capacity, PROT_READ | PROT_WRITE, MAP_SHARED, segment->fd, 0);
+      if (mapping != MAP_FAILED) {
+        segment->base = static_cast<std::byte *>(mapping);
+        return segment;
+      }
+    }
+
+    ::close(segment->fd);
+    std::filesystem::remove(segment->path, ec);
+    return nullptr;
+  }
+
+  bool MappedLogFile::rollOver(std::uint64_t fullIndex, std::size_t recordSize) {
+    std::lock_guard<std::mutex> lock(rollMutex_);
+    Segment *full = current_.load(std::memory_order_acquire);
+    if (full == nullptr || full->index != fullIndex) {
+      return full != nullptr; // Another writer already rolled over (or the log was closed)
+    }
+
+    auto segment = createSegment(recordSize);
+    if (!segment) {
+      return false;
+    }
+
+    retired_.push_back(full);
+    current_.store(segment.get(), std::memory_order_seq_cst);
+    segments_.push_back(std::move(segment));
+
+    if (!syncThread_.joinable()) {
+      finalizeRetired(false);
+      freeFinalized();
+    }
+    return true;
+  }
+
+  void MappedLogFile::finalizeRetired(bool wait) {
+    // Caller holds rollMutex_
+    auto it = retired_.begin();
+    while (it != retired_.end()) {
+      Segment *segment = *it;
+      while (wait && segment->writers.load(std::memory_order_seq_cst) != 0) {
+        std::this_thread::yield();
+      }
+      if (segment->writers.load(std::memory_order_seq_cst) != 0) {
+        ++it;
+        continue;
+      }
+      finalizeSegment(*segment);
+      it = retired_.erase(it);
+    }
+  }
+
+  void MappedLogFile::freeFinalized() {
+    // Caller holds rollMutex_. An appender that loaded a retired segment before the rollover
+    // is either still entering or counted in its writers, so checking both in this order
+    // proves that nobody can reach the segment any more.
+    if (entering_.load(std::memory_order_seq_cst) != 0) {
+      return; // Retried after the next rollover or sync
+    }
+    std::erase_if(segments_, [](const std::unique_ptr<Segment> &segment) {
+      return segment->finalized && segment->writers.load(std::memory_order_seq_cst) == 0;
+    });
+  }
+
+  void MappedLogFile::finalizeSegment(Segment &segment) {
+    if (segment.finalized) {
+      return;
+    }
+    segment.finalized = true;
+
+    const std::size_t used = std::min({segment.tail.load(std::memory_order_acquire),
+                                       segment.sealedAt.load(std::memory_order_acquire),
+                                       segment.capacity});
+    ::msync(segment.base, segment.capacity, MS_SYNC);
+    ::munmap(segment.base, segment.capacity);
+    segment.base = nullptr;
+
+    // Drop the unused preallocated tail so readers see only complete records
+    if (::ftruncate(segment.fd, static_cast<off_t>(used)) == 0) {
+      ::fdatasync(segment.fd);
+    }
+    ::close(segment.fd);
+    segment.fd = -1;
+  }
+
+  void MappedLogFile::syncLoop() {
+    std::unique_lock<std::mutex> syncLock(syncMutex_);
+    while (!stopSync_) {
+      syncCv_.wait_for(syncLock, syncInterval_, [this] { return stopSync_; });
+      if (stopSync_) {
+        break;
+      }
+      syncLock.unlock();
+
+      // Only this thread and close() (after joining it) unmap segments, so the active segment
+      // can be msynced without holding rollMutex_ and blocking a concurrent rollover
+      Segment *active = current_.load(std::memory_order_acquire);
+      if (active != nullptr) {
+        ::msync(active->base, active->capacity, MS_SYNC);
+      }
+
+      std::vector<Segment *> retired;
+      {
+        std::lock_guard<std::mutex> lock(rollMutex_);
+        retired.swap(retired_);
+      }
+      std::vector<Segment *> busy;
+      for (Segment *segment : retired) {
+        if (segment->writers.load(std::memory_order_seq_cst) != 0) {
+          busy.push_back(segment);
+        } else {
+          finalizeSegment(*segment);
+        }
+      }
+      {
+        std::lock_guard<std::mutex> lock(rollMutex_);
+        retired_.insert(retired_.end(), busy.begin(), busy.end());
+        freeFinalized();
+      }
+
+      syncLock.lock();
+    }
+  }
+
+#endif // _WIN32
+
+} // namespace dotnamecpp::logging
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace dotnamecpp::logging {
+
+  /**
+   * @brief Append-only log file backed by preallocated, memory-mapped segments
+   *
+   * Every append reserves a disjoint byte range of the current segment with a single atomic
+   * fetch_add on the tail offset and copies the record into the mapping - no mutex and no
+   * syscall per record. When a segment is full it is sealed and the next one is created
+   * (`<stem>.<index><ext>`); only this rollover takes a lock. A background thread msyncs the
+   * active segment every syncInterval and finalizes sealed segments (unmap and truncate to the
+   * bytes actually written). Finalized segments are freed as soon as no appender can still
+   * reach them, so memory stays bounded however often the log rotates.
+   *
+   * Not available on Windows - open() returns false there.
+   */
+  class MappedLogFile {
+  public:
+    static constexpr std::size_t kDefaultSegmentSize = 16 * 1024 * 1024;
+    static constexpr std::chrono::milliseconds kDefaultSyncInterval{1000};
+
+    MappedLogFile() = default;
+    ~MappedLogFile();
+
+    MappedLogFile(const MappedLogFile &) = delete;
+    MappedLogFile &operator=(const MappedLogFile &) = delete;
+    MappedLogFile(MappedLogFile &&) = delete;
+    MappedLogFile &operator=(MappedLogFile &&) = delete;
+
+    /**
+     * @brief Create the first segment and start the sync timer
+     *
+     * @param basePath Log file path, segment index is inserted before the extension
+     * @param segmentSize Bytes preallocated per segment
+     * @param syncInterval msync period, zero disables the background timer
+     * @return true on success
+     */
+    bool open(const std::filesystem::path &basePath, std::size_t segmentSize = kDefaultSegmentSize,
+              std::chrono::milliseconds syncInterval = kDefaultSyncInterval);
+
+    /**
+     * @brief Flush, unmap and truncate all segments. Appends must have finished.
+     *
+     */
+    void close();
+
+    /**
+     * @brief Append a record, safe to call from any number of threads concurrently
+     *
+     * @param record
+     * @return false if the log is closed or a new segment could not be created
+     */
+    bool append(std::string_view record);
+
+    /**
+     * @brief Synchronously msync the active segment
+     *
+     */
+    void sync();
+
+    [[nodiscard]]
+    bool isOpen() const noexcept {
+      return current_.load(std::memory_order_acquire) != nullptr;
+    }
+
+    /**
+     * @brief Path of the segment currently receiving appends
+     *
+     * @return std::filesystem::path
+     */
+    [[nodiscard]]
+    std::filesystem::path currentSegmentPath() const;
+
+    /**
+     * @brief Number of segments held in memory: the active one and those not yet freed
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t liveSegmentCount() const;
+
+  private:
+    struct Segment {
+      std::uint64_t index = 0;
+      std::filesystem::path path;
+      std::byte *base = nullptr;
+      std::size_t capacity = 0;
+      int fd = -1;
+      bool finalized = false;
+      std::atomic<std::size_t> tail{0};
+      std::atomic<std::size_t> sealedAt{SIZE_MAX};
+      std::atomic<int> writers{0};
+    };
+
+    std::unique_ptr<Segment> createSegment(std::size_t minCapacity);
+    bool rollOver(std::uint64_t fullIndex, std::size_t recordSize);
+    void finalizeRetired(bool wait);
+    void freeFinalized();
+    static void finalizeSegment(Segment &segment);
+    void syncLoop();
+
+    std::filesystem::path basePath_;
+    std::size_t segmentSize_ = kDefaultSegmentSize;
+    std::chrono::milliseconds syncInterval_ = kDefaultSyncInterval;
+    std::uint64_t nextIndex_ = 0;
+
+    std::atomic<Segment *> current_{nullptr};
+    // Appenders between loading current_ and registering in its writer count; while none
+    // is, no appender can reach a retired segment without being counted as its writer
+    std::atomic<int> entering_{0};
+
+    // Guards segment creation, the retired list and the owned segments
+    mutable std::mutex rollMutex_;
+    std::vector<std::unique_ptr<Segment>> segments_;
+    std::vector<Segment *> retired_;
+
+    std::mutex syncMutex_;
+    std::condition_variable syncCv_;
+    bool stopSync_ = false;
+    std::thread syncThread_;
+  };
+
+} // namespace dotnamecpp::logging
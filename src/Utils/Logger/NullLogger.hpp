@@ -24,6 +24,10 @@ namespace dotnamecpp::logging {
     bool enableFileLogging(const std::string & /*filename*/) override { return true; }
 
     void disableFileLogging() override {}
+
+#if __cplusplus >= 202002L
+    void logAt(Level /*level*/, const std::string & /*message*/, CallSiteId /*site*/) override {}
+#endif
   };
 
 } // namespace dotnamecpp::logging
\ No newline at end of file
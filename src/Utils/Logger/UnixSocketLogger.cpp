@@ -0,0 +1,226 @@
+#include "UnixSocketLogger.hpp"
+
+#ifndef _WIN32
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace dotnamecpp::logging {
+
+  UnixSocketLogger::UnixSocketLogger(std::string socketPath, std::size_t batchSize,
+                                     std::size_t queueCapacity)
+      : socketPath_(std::move(socketPath)), batchSize_(batchSize == 0 ? 1 : batchSize),
+        queueCapacity_(queueCapacity == 0 ? 1 : queueCapacity) {
+    if (socketPath_.empty() || socketPath_.size() >= sizeof(sockaddr_un::sun_path)) {
+      return;
+    }
+
+    socketFd_ = ::socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (socketFd_ < 0) {
+      return;
+    }
+
+    const int flags = ::fcntl(socketFd_, F_GETFL, 0);
+    ::fcntl(socketFd_, F_SETFL, flags | O_NONBLOCK);
+    ::fcntl(socketFd_, F_SETFD, FD_CLOEXEC);
+
+    flusher_ = std::thread(&UnixSocketLogger::flushPeriodically, this);
+  }
+
+  UnixSocketLogger::~UnixSocketLogger() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    if (flusher_.joinable()) {
+      flusher_.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    flushLocked();
+    if (socketFd_ >= 0) {
+      ::close(socketFd_);
+      socketFd_ = -1;
+    }
+  }
+
+  void UnixSocketLogger::log(Level level, const std::string &message, const std::string &caller) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (level < currentLevel_) {
+      return;
+    }
+
+    const bool wasEmpty = pending_.empty();
+    if (wasEmpty) {
+      oldestPending_ = std::chrono::steady_clock::now();
+    }
+    pending_.push_back(formatRecord(level, message, caller));
+
+    // Bounded retry queue - drop the oldest records first
+    while (pending_.size() > queueCapacity_) {
+      pending_.pop_front();
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (pending_.size() >= batchSize_ || level >= Level::LOG_ERROR ||
+        std::chrono::steady_clock::now() - oldestPending_ >= flushInterval_) {
+      flushLocked();
+    }
+    if (wasEmpty && !pending_.empty()) {
+      wake_.notify_one(); // Start the flush deadline of the new partial batch
+    }
+  }
+
+  void UnixSocketLogger::flushPeriodically() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopping_) {
+      if (pending_.empty()) {
+        wake_.wait(lock);
+        continue;
+      }
+      // Re-evaluated after every wake-up: records may have been sent or the interval changed.
+      // Failed sends are retried no sooner than kMinRetryInterval, so a short interval does
+      // not turn into a busy loop while the collector is down.
+      const auto delay = retrying_ ? std::max(flushInterval_, kMinRetryInterval) : flushInterval_;
+      if (wake_.wait_until(lock, oldestPending_ + delay) == std::cv_status::timeout &&
+          !pending_.empty() && std::chrono::steady_clock::now() - oldestPending_ >= delay) {
+        flushLocked();
+      }
+    }
+  }
+
+  bool UnixSocketLogger::flush() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return flushLocked();
+  }
+
+  bool UnixSocketLogger::flushLocked() {
+    if (socketFd_ < 0) {
+      if (!pending_.empty()) {
+        oldestPending_ = std::chrono::steady_clock::now();
+        retrying_ = true;
+      }
+      return pending_.empty();
+    }
+
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, socketPath_.c_str(), socketPath_.size() + 1);
+
+    std::string datagram;
+    datagram.reserve(kMaxDatagramSize);
+
+    while (!pending_.empty()) {
+      // Pack as many queued records as fit into one datagram
+      std::size_t count = 0;
+      datagram.clear();
+      for (const auto &record : pending_) {
+        if (count == batchSize_ ||
+            (count > 0 && datagram.size() + record.size() > maxDatagramSize_)) {
+          break;
+        }
+        datagram += record;
+        ++count;
+      }
+
+      const ssize_t sent =
+          ::sendto(socketFd_, datagram.data(), datagram.size(), MSG_DONTWAIT,
+                   reinterpret_cast<const sockaddr *>(&addr), sizeof(addr));
+      if (sent < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        if (errno == EMSGSIZE) {
+          if (count > 1) {
+            // Platform datagram limit is below ours (e.g. macOS) - shrink the batches
+            maxDatagramSize_ = datagram.size() / 2;
+            continue;
+          }
+          // A single record larger than the socket allows can never be delivered
+          pending_.pop_front();
+          dropped_.fetch_add(1, std::memory_order_relaxed);
+          continue;
+        }
+        // Collector not listening or socket buffer full - keep records for the next flush
+        oldestPending_ = std::chrono::steady_clock::now();
+        retrying_ = true;
+        return false;
+      }
+
+      for (std::size_t i = 0; i < count; ++i) {
+        pending_.pop_front();
+      }
+    }
+
+    retrying_ = false;
+    return true;
+  }
+
+  std::string UnixSocketLogger::formatRecord(Level level, const std::string &message,
+                                             const std::string &caller) const {
+    auto now = std::chrono::system_clock::now();
+    std::time_t now_c = std::chrono::system_clock::to_time_t(now);
+    std::tm now_tm{};
+    localtime_r(&now_c, &now_tm);
+
+    char timeBuffer[32];
+    const std::size_t timeLength =
+        std::strftime(timeBuffer, sizeof(timeBuffer), "%Y-%m-%d %H:%M:%S", &now_tm);
+
+    std::string record;
+    record.reserve(appPrefix_.size() + caller.size() + message.size() + 40);
+    if (!appPrefix_.empty()) {
+      record.append("[").append(appPrefix_).append("]");
+    }
+    record.append("[").append(timeBuffer, timeLength).append("]");
+    record.append("[").append(levelTag(level)).append("]");
+    if (!caller.empty()) {
+      record.append("[").append(caller).append("]");
+    }
+    record.append(" ").append(message).append("\n");
+    return record;
+  }
+
+  void UnixSocketLogger::setLevel(Level level) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    currentLevel_ = level;
+  }
+
+  Level UnixSocketLogger::getLevel() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return currentLevel_;
+  }
+
+  void UnixSocketLogger::setAppPrefix(const std::string &prefix) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    appPrefix_ = prefix;
+  }
+
+  std::string UnixSocketLogger::getAppPrefix() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return appPrefix_;
+  }
+
+  void UnixSocketLogger::setFlushInterval(std::chrono::milliseconds interval) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      flushInterval_ = std::max(interval, std::chrono::milliseconds::zero());
+    }
+    wake_.notify_all();
+  }
+
+  std::size_t UnixSocketLogger::pendingCount() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.size();
+  }
+
+} // namespace dotnamecpp::logging
+
+#endif // _WIN32
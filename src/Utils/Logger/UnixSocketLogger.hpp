@@ -0,0 +1,190 @@
+#pragma once
+
+#ifndef _WIN32
+
+#include "ILogger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace dotnamecpp::logging {
+
+  /**
+   * @brief Logger that ships formatted records to a local collector over an AF_UNIX socket
+   *
+   * Each record is formatted like the console output and sent as part of a datagram to the
+   * collector bound at the configured socket path. Sends never block: records that cannot be
+   * delivered right away (collector down, socket buffer full) stay in a bounded retry queue and
+   * are sent with the next flush. When the queue is full, the oldest records are dropped.
+   *
+   * Up to batchSize records are joined (newline separated) into one datagram. Records below
+   * LOG_ERROR wait in the queue until a batch fills up, flushInterval expires or flush() is
+   * called; errors and critical records flush the queue immediately. A background thread
+   * sends partial batches once flushInterval has passed, and retries undelivered records at
+   * the same pace, but no more often than every kMinRetryInterval, without waiting for the
+   * next record.
+   */
+  class UnixSocketLogger : public ILogger {
+  public:
+    static constexpr std::size_t kDefaultBatchSize = 16;
+    static constexpr std::size_t kDefaultQueueCapacity = 1024;
+    static constexpr std::size_t kMaxDatagramSize = 16 * 1024;
+    static constexpr std::chrono::milliseconds kDefaultFlushInterval{250};
+    static constexpr std::chrono::milliseconds kMinRetryInterval{50};
+
+    /**
+     * @brief Construct a new Unix Socket Logger object
+     *
+     * @param socketPath Path of the collector's datagram socket
+     * @param batchSize Maximum number of records per datagram
+     * @param queueCapacity Maximum number of records held while the collector is unreachable
+     */
+    explicit UnixSocketLogger(std::string socketPath, std::size_t batchSize = kDefaultBatchSize,
+                              std::size_t queueCapacity = kDefaultQueueCapacity);
+    ~UnixSocketLogger() override;
+
+    UnixSocketLogger(const UnixSocketLogger &) = delete;
+    UnixSocketLogger &operator=(const UnixSocketLogger &) = delete;
+    UnixSocketLogger(UnixSocketLogger &&) = delete;
+    UnixSocketLogger &operator=(UnixSocketLogger &&) = delete;
+
+    void debug(const std::string &message, const std::string &caller = "") override {
+      log(Level::LOG_DEBUG, message, caller);
+    }
+
+    void info(const std::string &message, const std::string &caller = "") override {
+      log(Level::LOG_INFO, message, caller);
+    }
+
+    void warning(const std::string &message, const std::string &caller = "") override {
+      log(Level::LOG_WARNING, message, caller);
+    }
+
+    void error(const std::string &message, const std::string &caller = "") override {
+      log(Level::LOG_ERROR, message, caller);
+    }
+
+    void critical(const std::string &message, const std::string &caller = "") override {
+      log(Level::LOG_CRITICAL, message, caller);
+    }
+
+    /**
+     * @brief Format a record and queue it for the collector
+     *
+     * @param level
+     * @param message
+     * @param caller
+     */
+    void log(Level level, const std::string &message, const std::string &caller);
+
+    /**
+     * @brief Render the call site only for records that pass the level filter
+     *
+     * @param level
+     * @param message
+     * @param site
+     */
+    void logAt(Level level, const std::string &message, CallSiteId site) override {
+      if (level >= getLevel()) {
+        log(level, message, CallSiteRegistry::format(site));
+      }
+    }
+
+    void setLevel(Level level) override;
+
+    [[nodiscard]]
+    Level getLevel() const override;
+
+    void setAppPrefix(const std::string &prefix) override;
+
+    [[nodiscard]]
+    std::string getAppPrefix() const override;
+
+    /**
+     * @brief Not supported - records go to the collector only
+     *
+     * @return false
+     */
+    bool enableFileLogging(const std::string & /*filename*/) override { return false; }
+
+    void disableFileLogging() override {}
+
+    /**
+     * @brief Send all queued records without blocking
+     *
+     * @return true if the queue is empty afterwards
+     */
+    bool flush();
+
+    /**
+     * @brief Set how long a partial batch may wait in the queue
+     *
+     * Zero sends every record right away; negative intervals are treated as zero.
+     *
+     * @param interval
+     */
+    void setFlushInterval(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Number of records waiting for delivery
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t pendingCount() const;
+
+    /**
+     * @brief Number of records dropped because the retry queue was full
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]]
+    std::size_t droppedCount() const noexcept {
+      return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Check whether the socket was created successfully
+     *
+     * @return true
+     * @return false
+     */
+    [[nodiscard]]
+    bool isOpen() const noexcept {
+      return socketFd_ >= 0;
+    }
+
+  private:
+    void flushPeriodically();
+    bool flushLocked();
+    [[nodiscard]]
+    std::string formatRecord(Level level, const std::string &message,
+                             const std::string &caller) const;
+
+    mutable std::mutex mutex_;
+    int socketFd_ = -1;
+    std::string socketPath_;
+    std::size_t batchSize_;
+    std::size_t queueCapacity_;
+    std::size_t maxDatagramSize_ = kMaxDatagramSize;
+    std::chrono::milliseconds flushInterval_ = kDefaultFlushInterval;
+    std::chrono::steady_clock::time_point oldestPending_;
+    bool retrying_ = false; // The last send failed, records wait for the next retry
+    std::deque<std::string> pending_;
+    std::atomic<std::size_t> dropped_{0};
+    std::string appPrefix_;
+    Level currentLevel_ = Level::LOG_INFO;
+    std::condition_variable wake_; // Signals new pending records or shutdown to flusher_
+    bool stopping_ = false;
+    std::thread flusher_;
+  };
+
+} // namespace dotnamecpp::logging
+
+#endif // _WIN32
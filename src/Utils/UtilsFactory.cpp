@@ -18,10 +18,25 @@ namespace dotnamecpp::utils {
     return std::make_shared<FileReader>();
   }
 
+  std::shared_ptr<CachingFileReader>
+      UtilsFactory::createCachingFileReader(const FileCacheConfig &config,
+                                            std::shared_ptr<FileWatcher> watcher) {
+    return std::make_shared<CachingFileReader>(createFileReader(), config, std::move(watcher));
+  }
+
+  std::shared_ptr<FileWatcher> UtilsFactory::createFileWatcher(const FileWatcherOptions &options) {
+    return std::make_shared<FileWatcher>(options);
+  }
+
   std::shared_ptr<IFileWriter> UtilsFactory::createFileWriter() {
     return std::make_shared<FileWriter>();
   }
 
+  std::shared_ptr<AsyncFileWriter>
+      UtilsFactory::createAsyncFileWriter(AsyncWriterOptions options) {
+    return std::make_shared<AsyncFileWriter>(createFileWriter(), std::move(options));
+  }
+
   std::shared_ptr<IPathResolver> UtilsFactory::createPathResolver() {
     return std::make_shared<PathResolver>();
   }
@@ -2,6 +2,8 @@
 
 #include <DotNameLib/version.h>
 #include <Utils/Assets/IAssetManager.hpp>
+#include <Utils/Filesystem/AsyncFileWriter.hpp>
+#include <Utils/Filesystem/CachingFileReader.hpp>
 #include <Utils/Filesystem/IDirectoryManager.hpp>
 #include <Utils/Filesystem/IFileReader.hpp>
 #include <Utils/Filesystem/IFileWriter.hpp>
@@ -29,8 +31,17 @@ namespace dotnamecpp::utils {
     [[nodiscard]]
     static std::shared_ptr<IFileReader> createFileReader();
     [[nodiscard]]
+    static std::shared_ptr<CachingFileReader>
+        createCachingFileReader(const FileCacheConfig &config = {},
+                                std::shared_ptr<FileWatcher> watcher = nullptr);
+    [[nodiscard]]
+    static std::shared_ptr<FileWatcher> createFileWatcher(const FileWatcherOptions &options = {});
+    [[nodiscard]]
     static std::shared_ptr<IFileWriter> createFileWriter();
     [[nodiscard]]
+    static std::shared_ptr<AsyncFileWriter>
+        createAsyncFileWriter(AsyncWriterOptions options = {});
+    [[nodiscard]]
     static std::shared_ptr<IPathResolver> createPathResolver();
     [[nodiscard]]
     static std::shared_ptr<IDirectoryManager> createDirectoryManager();